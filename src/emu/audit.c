@@ -422,19 +422,35 @@ audit_record *media_auditor::audit_one_rom(const rom_entry *rom)
 	emu_file file(m_enumerator.options().media_path(), OPEN_FLAG_READ | OPEN_FLAG_NO_PRELOAD);
 	path_iterator path(m_searchpath);
 	astring curpath;
+	astring key;
 	while (path.next(curpath, record.name()))
 	{
-		// open the file if we can
-		file_error filerr;
-		if (has_crc)
-			filerr = file.open(curpath, crc);
-		else
-			filerr = file.open(curpath);
+		// clones and BIOS children look in the same places over and over, so
+		// check whether we've already been here with the same expectations
+		key.printf("%s\t%d\t%08X\t%s", curpath.cstr(), has_crc, crc, m_validation);
+		cached_file *cached = m_file_cache.find(key);
+		if (cached == NULL)
+		{
+			// open the file if we can
+			file_error filerr;
+			if (has_crc)
+				filerr = file.open(curpath, crc);
+			else
+				filerr = file.open(curpath);
+
+			// remember the actual length and hashes, or that there was nothing here
+			if (filerr == FILERR_NONE)
+				cached = &m_cached_files.append(*global_alloc(cached_file(true, file.hashes(m_validation), file.size())));
+			else
+				cached = &m_cached_files.append(*global_alloc(cached_file(false, hash_collection(), 0)));
+			file.close();
+			m_file_cache.add(key, cached);
+		}
 
 		// if it worked, get the actual length and hashes, then stop
-		if (filerr == FILERR_NONE)
+		if (cached->found())
 		{
-			record.set_actual(file.hashes(m_validation), file.size());
+			record.set_actual(cached->hashes(), cached->length());
 			break;
 		}
 	}
@@ -152,6 +152,28 @@ public:
 	summary summarize(const char *name,astring *output = NULL);
 
 private:
+	// result of looking for one file along the search path, remembered so
+	// that ROMs shared between sets are only opened and hashed once
+	class cached_file
+	{
+		friend class simple_list<cached_file>;
+
+	public:
+		cached_file(bool found, const hash_collection &hashes, UINT64 length)
+			: m_next(NULL), m_found(found), m_hashes(hashes), m_length(length) { }
+
+		cached_file *next() const { return m_next; }
+		bool found() const { return m_found; }
+		const hash_collection &hashes() const { return m_hashes; }
+		UINT64 length() const { return m_length; }
+
+	private:
+		cached_file *       m_next;
+		bool                m_found;
+		hash_collection     m_hashes;
+		UINT64              m_length;
+	};
+
 	// internal helpers
 	audit_record *audit_one_rom(const rom_entry *rom);
 	audit_record *audit_one_disk(const rom_entry *rom, const char *locationtag = NULL);
@@ -163,6 +185,8 @@ private:
 	const driver_enumerator &   m_enumerator;
 	const char *                m_validation;
 	const char *                m_searchpath;
+	simple_list<cached_file>    m_cached_files;
+	tagmap_t<cached_file *>     m_file_cache;
 };
 
 
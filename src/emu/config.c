@@ -146,6 +146,19 @@ int config_load_settings(running_machine &machine)
 }
 
 
+void config_apply_defaults(running_machine &machine)
+{
+	config_type *type;
+
+	/* run the init and final load callbacks without reading any files, */
+	/* leaving every registrant with its built-in defaults */
+	for (type = typelist; type; type = type->next)
+		type->load(CONFIG_TYPE_INIT, NULL);
+	for (type = typelist; type; type = type->next)
+		type->load(CONFIG_TYPE_FINAL, NULL);
+}
+
+
 void config_save_settings(running_machine &machine)
 {
 	config_type *type;
@@ -56,6 +56,7 @@ typedef delegate<void (int, xml_data_node *)> config_saveload_delegate;
 void config_init(running_machine &machine);
 void config_register(running_machine &machine, const char *nodename, config_saveload_delegate load, config_saveload_delegate save);
 int config_load_settings(running_machine &machine);
+void config_apply_defaults(running_machine &machine);
 void config_save_settings(running_machine &machine);
 
 #endif  /* __CONFIG_H__ */
@@ -546,9 +546,16 @@ UINT16 i386_device::FETCH16()
 	UINT16 value;
 	UINT32 address = m_pc, error;
 
-	if( address & 0x1 ) {       /* Unaligned read */
+	if( (address & 0xfff) == 0xfff ) {       /* Unaligned read across a page */
 		value = (FETCH() << 0);
 		value |= (FETCH() << 8);
+	} else if( address & 0x1 ) {     /* Unaligned read within a page; translate once */
+		if(!translate_address(m_CPL,TRANSLATE_FETCH,&address,&error))
+			PF_THROW(error);
+		address &= m_a20_mask;
+		value = m_direct->read_decrypted_byte(address) | (m_direct->read_decrypted_byte(address+1) << 8);
+		m_eip += 2;
+		m_pc += 2;
 	} else {
 		if(!translate_address(m_CPL,TRANSLATE_FETCH,&address,&error))
 			PF_THROW(error);
@@ -564,11 +571,20 @@ UINT32 i386_device::FETCH32()
 	UINT32 value;
 	UINT32 address = m_pc, error;
 
-	if( m_pc & 0x3 ) {      /* Unaligned read */
+	if( (m_pc & 0xfff) > 0xffc ) {      /* Unaligned read across a page */
 		value = (FETCH() << 0);
 		value |= (FETCH() << 8);
 		value |= (FETCH() << 16);
 		value |= (FETCH() << 24);
+	} else if( m_pc & 0x3 ) {       /* Unaligned read within a page; translate once */
+		if(!translate_address(m_CPL,TRANSLATE_FETCH,&address,&error))
+			PF_THROW(error);
+
+		address &= m_a20_mask;
+		value = m_direct->read_decrypted_byte(address) | (m_direct->read_decrypted_byte(address+1) << 8) |
+				(m_direct->read_decrypted_byte(address+2) << 16) | (m_direct->read_decrypted_byte(address+3) << 24);
+		m_eip += 4;
+		m_pc += 4;
 	} else {
 		if(!translate_address(m_CPL,TRANSLATE_FETCH,&address,&error))
 			PF_THROW(error);
@@ -596,9 +612,16 @@ UINT16 i386_device::READ16(UINT32 ea)
 	UINT16 value;
 	UINT32 address = ea, error;
 
-	if( ea & 0x1 ) {        /* Unaligned read */
+	if( (ea & 0xfff) == 0xfff ) {       /* Unaligned read across a page */
 		value = (READ8( address+0 ) << 0);
 		value |= (READ8( address+1 ) << 8);
+	} else if( ea & 0x1 ) {     /* Unaligned read within a page; translate once */
+		if(!translate_address(m_CPL,TRANSLATE_READ,&address,&error))
+			PF_THROW(error);
+
+		address &= m_a20_mask;
+		value = (m_program->read_byte( address+0 ) << 0);
+		value |= (m_program->read_byte( address+1 ) << 8);
 	} else {
 		if(!translate_address(m_CPL,TRANSLATE_READ,&address,&error))
 			PF_THROW(error);
@@ -613,11 +636,20 @@ UINT32 i386_device::READ32(UINT32 ea)
 	UINT32 value;
 	UINT32 address = ea, error;
 
-	if( ea & 0x3 ) {        /* Unaligned read */
+	if( (ea & 0xfff) > 0xffc ) {        /* Unaligned read across a page */
 		value = (READ8( address+0 ) << 0);
 		value |= (READ8( address+1 ) << 8);
 		value |= (READ8( address+2 ) << 16),
 		value |= (READ8( address+3 ) << 24);
+	} else if( ea & 0x3 ) {     /* Unaligned read within a page; translate once */
+		if(!translate_address(m_CPL,TRANSLATE_READ,&address,&error))
+			PF_THROW(error);
+
+		address &= m_a20_mask;
+		value = (m_program->read_byte( address+0 ) << 0);
+		value |= (m_program->read_byte( address+1 ) << 8);
+		value |= (m_program->read_byte( address+2 ) << 16);
+		value |= (m_program->read_byte( address+3 ) << 24);
 	} else {
 		if(!translate_address(m_CPL,TRANSLATE_READ,&address,&error))
 			PF_THROW(error);
@@ -1568,6 +1568,11 @@ const void SLEEP(sh4_state *sh4, const UINT16 opcode)
 		sh4->sleep_mode = 1;
 	else if(sh4->sleep_mode == 2)
 		sh4->sleep_mode = 0;
+
+	/* interrupts only get raised between timeslices, so if none is pending */
+	/* nothing can wake us before the end of this one; don't spin on SLEEP */
+	if(sh4->sleep_mode == 1 && !sh4->test_irq && sh4->sh4_icount > 1 && (sh4->device->machine().debug_flags & DEBUG_FLAG_ENABLED) == 0)
+		sh4->sh4_icount = 1;
 }
 
 /*  STC     SR,Rn */
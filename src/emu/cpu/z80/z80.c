@@ -426,6 +426,23 @@ inline void z80_device::leave_halt()
 	}
 }
 
+/***************************************************************
+ * While halted, the CPU only executes internal NOPs until an
+ * interrupt arrives, so burn the rest of the timeslice in one
+ * go; with the debugger active, keep stepping one at a time
+ ***************************************************************/
+inline bool z80_device::burn_halt()
+{
+	int cycles = m_cc_op[0x76];
+	if (!m_halt || cycles == 0 || (machine().debug_flags & DEBUG_FLAG_ENABLED) != 0)
+		return false;
+
+	int count = (m_icount + cycles - 1) / cycles;
+	m_r += count;
+	m_icount -= count * cycles;
+	return true;
+}
+
 /***************************************************************
  * Input a byte from given I/O port
  ***************************************************************/
@@ -3515,6 +3532,9 @@ void z80_device::execute_run()
 		m_after_ei = FALSE;
 		m_after_ldair = FALSE;
 
+		if (burn_halt())
+			break;
+
 		PRVPC = PCD;
 		debugger_instruction_hook(this, PCD);
 		m_r++;
@@ -3553,6 +3573,9 @@ void nsc800_device::execute_run()
 
 		m_after_ei = FALSE;
 
+		if (burn_halt())
+			break;
+
 		PRVPC = PCD;
 		debugger_instruction_hook(this, PCD);
 		m_r++;
@@ -144,6 +144,7 @@ protected:
 
 	void halt();
 	void leave_halt();
+	bool burn_halt();
 	UINT8 in(UINT16 port);
 	void out(UINT16 port, UINT8 value);
 	UINT8 rm(UINT16 addr);
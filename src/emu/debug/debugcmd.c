@@ -128,6 +128,8 @@ static void execute_rpclear(running_machine &machine, int ref, int params, const
 static void execute_rpdisenable(running_machine &machine, int ref, int params, const char **param);
 static void execute_rplist(running_machine &machine, int ref, int params, const char **param);
 static void execute_hotspot(running_machine &machine, int ref, int params, const char **param);
+static void execute_pcsample(running_machine &machine, int ref, int params, const char **param);
+static void execute_pcsamplist(running_machine &machine, int ref, int params, const char **param);
 static void execute_statesave(running_machine &machine, int ref, int params, const char **param);
 static void execute_stateload(running_machine &machine, int ref, int params, const char **param);
 static void execute_save(running_machine &machine, int ref, int params, const char **param);
@@ -141,6 +143,7 @@ static void execute_dasm(running_machine &machine, int ref, int params, const ch
 static void execute_find(running_machine &machine, int ref, int params, const char **param);
 static void execute_trace(running_machine &machine, int ref, int params, const char **param);
 static void execute_traceover(running_machine &machine, int ref, int params, const char **param);
+static void execute_tracebin(running_machine &machine, int ref, int params, const char **param);
 static void execute_traceflush(running_machine &machine, int ref, int params, const char **param);
 static void execute_history(running_machine &machine, int ref, int params, const char **param);
 static void execute_trackpc(running_machine &machine, int ref, int params, const char **param);
@@ -326,6 +329,8 @@ void debug_command_init(running_machine &machine)
 	debug_console_register_command(machine, "rplist",    CMDFLAG_NONE, 0, 0, 0, execute_rplist);
 
 	debug_console_register_command(machine, "hotspot",   CMDFLAG_NONE, 0, 0, 3, execute_hotspot);
+	debug_console_register_command(machine, "pcsample",  CMDFLAG_NONE, 0, 0, 2, execute_pcsample);
+	debug_console_register_command(machine, "pcsamplist",CMDFLAG_NONE, 0, 0, 3, execute_pcsamplist);
 
 	debug_console_register_command(machine, "statesave", CMDFLAG_NONE, 0, 1, 1, execute_statesave);
 	debug_console_register_command(machine, "ss",        CMDFLAG_NONE, 0, 1, 1, execute_statesave);
@@ -372,6 +377,7 @@ void debug_command_init(running_machine &machine)
 
 	debug_console_register_command(machine, "trace",     CMDFLAG_NONE, 0, 1, 3, execute_trace);
 	debug_console_register_command(machine, "traceover", CMDFLAG_NONE, 0, 1, 3, execute_traceover);
+	debug_console_register_command(machine, "tracebin",  CMDFLAG_NONE, 0, 1, 3, execute_tracebin);
 	debug_console_register_command(machine, "traceflush",CMDFLAG_NONE, 0, 0, 0, execute_traceflush);
 
 	debug_console_register_command(machine, "history",   CMDFLAG_NONE, 0, 0, 2, execute_history);
@@ -1699,6 +1705,152 @@ static void execute_hotspot(running_machine &machine, int ref, int params, const
 }
 
 
+/*-------------------------------------------------
+    execute_pcsample - execute the pcsample
+    command
+-------------------------------------------------*/
+
+static void execute_pcsample(running_machine &machine, int ref, int params, const char *param[])
+{
+	/* if no params, and there are live samplers, stop them */
+	if (params == 0)
+	{
+		bool stopped = false;
+
+		/* loop over CPUs and find live samplers */
+		device_iterator iter(machine.root_device());
+		for (device_t *device = iter.first(); device != NULL; device = iter.next())
+			if (device->debug() != NULL && device->debug()->pc_sampling_enabled())
+			{
+				device->debug()->pc_sample(0);
+				debug_console_printf(machine, "Stopped PC sampling on CPU '%s' after %d samples\n", device->tag(), device->debug()->pc_sample_total());
+				stopped = true;
+			}
+
+		/* if we stopped, we're done */
+		if (stopped)
+			return;
+	}
+
+	/* extract parameters */
+	device_t *device = NULL;
+	if (!debug_command_parameter_cpu(machine, (params > 0) ? param[0] : NULL, &device))
+		return;
+	UINT64 period = 1000;
+	if (!debug_command_parameter_number(machine, param[1], &period))
+		return;
+	if (period == 0)
+	{
+		debug_console_printf(machine, "Sampling period must be non-zero\n");
+		return;
+	}
+
+	/* attempt to install */
+	device->debug()->pc_sample(period);
+	if (!device->debug()->pc_sampling_enabled())
+		debug_console_printf(machine, "Device '%s' does not execute code\n", device->tag());
+	else
+		debug_console_printf(machine, "Now sampling the PC of CPU '%s' every %d cycles\n", device->tag(), (int)period);
+}
+
+
+/*-------------------------------------------------
+    execute_pcsamplist - list the most frequently
+    sampled PCs, with their disassembly
+-------------------------------------------------*/
+
+struct pc_sample_entry
+{
+	offs_t  pc;
+	UINT32  count;
+};
+
+static int CLIB_DECL compare_pc_samples(const void *item1, const void *item2)
+{
+	const pc_sample_entry *entry1 = (const pc_sample_entry *)item1;
+	const pc_sample_entry *entry2 = (const pc_sample_entry *)item2;
+	if (entry1->count != entry2->count)
+		return (entry1->count > entry2->count) ? -1 : 1;
+	return (entry1->pc < entry2->pc) ? -1 : (entry1->pc > entry2->pc);
+}
+
+static void execute_pcsamplist(running_machine &machine, int ref, int params, const char *param[])
+{
+	/* validate parameters */
+	address_space *space;
+	if (!debug_command_parameter_cpu_space(machine, (params > 0) ? param[0] : NULL, AS_PROGRAM, space))
+		return;
+	UINT64 count = 20;
+	if (!debug_command_parameter_number(machine, param[1], &count))
+		return;
+
+	device_debug *debug = space->device().debug();
+	UINT32 total = debug->pc_sample_total();
+	if (total == 0)
+	{
+		debug_console_printf(machine, "No PC samples recorded for CPU '%s'\n", space->device().tag());
+		return;
+	}
+
+	/* optionally write to a file instead of the console */
+	FILE *f = NULL;
+	if (params > 2)
+	{
+		f = fopen(param[2], "w");
+		if (f == NULL)
+		{
+			debug_console_printf(machine, "Error opening file '%s'\n", param[2]);
+			return;
+		}
+	}
+
+	/* sort the PCs by number of samples */
+	const device_debug::pc_sample_map &samples = debug->pc_samples();
+	dynamic_array<pc_sample_entry> sorted(samples.size());
+	int entries = 0;
+	for (device_debug::pc_sample_map::const_iterator i = samples.begin(); i != samples.end(); ++i)
+	{
+		sorted[entries].pc = i->first;
+		sorted[entries++].count = i->second;
+	}
+	qsort(&sorted[0], entries, sizeof(sorted[0]), compare_pc_samples);
+	if (count == 0 || count > (UINT64)entries)
+		count = entries;
+
+	/* loop over lines */
+	int maxbytes = debug->max_opcode_bytes();
+	for (int index = 0; index < (int) count; index++)
+	{
+		offs_t pc = sorted[index].pc;
+
+		/* fetch the bytes up to the maximum */
+		offs_t pcbyte = space->address_to_byte(pc) & space->bytemask();
+		UINT8 opbuf[64], argbuf[64];
+		for (int numbytes = 0; numbytes < maxbytes; numbytes++)
+		{
+			opbuf[numbytes] = debug_read_opcode(*space, pcbyte + numbytes, 1, false);
+			argbuf[numbytes] = debug_read_opcode(*space, pcbyte + numbytes, 1, true);
+		}
+
+		char buffer[200];
+		debug->disassemble(buffer, pc, opbuf, argbuf);
+
+		astring line;
+		line.printf("%6.2f%% %8d  %s: %s\n", 100.0 * sorted[index].count / total, sorted[index].count, core_i64_hex_format(pc, space->logaddrchars()), buffer);
+		if (f != NULL)
+			fputs(line, f);
+		else
+			debug_console_printf(machine, "%s", line.cstr());
+	}
+
+	if (f != NULL)
+	{
+		fclose(f);
+		debug_console_printf(machine, "Wrote %d of %d sampled PCs to %s\n", (int)count, entries, param[2]);
+	}
+}
+
+
 /*-------------------------------------------------
     execute_statesave - execute the statesave command
 -------------------------------------------------*/
@@ -2632,6 +2784,47 @@ static void execute_traceover(running_machine &machine, int ref, int params, con
 }
 
 
+/*-------------------------------------------------
+    execute_tracebin - execute the binary trace
+    command
+-------------------------------------------------*/
+
+static void execute_tracebin(running_machine &machine, int ref, int params, const char *param[])
+{
+	const char *action = NULL;
+	device_t *cpu;
+	core_file *f = NULL;
+	astring filename = param[0];
+
+	/* replace macros */
+	filename.replace("{game}", machine.basename());
+
+	/* validate parameters */
+	if (!debug_command_parameter_cpu(machine, (params > 1) ? param[1] : NULL, &cpu))
+		return;
+	if (!debug_command_parameter_command(machine, action = param[2]))
+		return;
+
+	/* open the file; compressed streams can't be appended to */
+	if (mame_stricmp(filename, "off") != 0)
+	{
+		if (core_fopen(filename, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS, &f) != FILERR_NONE)
+		{
+			debug_console_printf(machine, "Error opening file '%s'\n", param[0]);
+			return;
+		}
+		core_fcompress(f, FCOMPRESS_MEDIUM);
+	}
+
+	/* do it */
+	cpu->debug()->trace_binary(f, action);
+	if (f)
+		debug_console_printf(machine, "Tracing CPU '%s' to binary file %s\n", cpu->tag(), filename.cstr());
+	else
+		debug_console_printf(machine, "Stopped tracing on CPU '%s'\n", cpu->tag());
+}
+
+
 /*-------------------------------------------------
     execute_traceflush - execute the trace flush command
 -------------------------------------------------*/
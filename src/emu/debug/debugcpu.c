@@ -1629,6 +1629,9 @@ device_debug::device_debug(device_t &device)
 		m_rplist(NULL),
 		m_trace(NULL),
 		m_hotspot_threshhold(0),
+		m_pcsample_period(0),
+		m_pcsample_next(0),
+		m_pcsample_total(0),
 		m_track_pc_set(),
 		m_track_pc(false),
 		m_comment_set(),
@@ -1637,6 +1640,7 @@ device_debug::device_debug(device_t &device)
 		m_track_mem(false)
 {
 	memset(m_pc_history, 0, sizeof(m_pc_history));
+	memset(m_bpfilter, 0, sizeof(m_bpfilter));
 	memset(m_wplist, 0, sizeof(m_wplist));
 
 	// find out which interfaces we have to work with
@@ -1841,6 +1845,16 @@ void device_debug::instruction_hook(offs_t curpc)
 	m_last_total_cycles = m_total_cycles;
 	m_total_cycles = m_exec->total_cycles();
 
+	// are we sampling the PC?
+	if ((m_flags & DEBUG_FLAG_PC_SAMPLE) != 0 && m_total_cycles >= m_pcsample_next)
+	{
+		// a slow instruction can span several periods; count each one
+		UINT32 count = (m_total_cycles - m_pcsample_next) / m_pcsample_period + 1;
+		m_pcsamples[curpc] += count;
+		m_pcsample_total += count;
+		m_pcsample_next += UINT64(count) * m_pcsample_period;
+	}
+
 	// are we tracking our recent pc visits?
 	if (m_track_pc)
 	{
@@ -2538,6 +2552,30 @@ void device_debug::registerpoint_enable_all(bool enable)
 }
 
 
+//-------------------------------------------------
+//  pc_sample - enable/disable sampling of the PC
+//  every 'period' cycles from the instruction
+//  hook
+//-------------------------------------------------
+
+void device_debug::pc_sample(UINT64 period)
+{
+	// stopping keeps the results around for reporting
+	m_pcsample_period = (m_exec != NULL) ? period : 0;
+	if (m_pcsample_period == 0)
+	{
+		m_flags &= ~DEBUG_FLAG_PC_SAMPLE;
+		return;
+	}
+
+	// starting resets them and counts from the current cycle
+	m_flags |= DEBUG_FLAG_PC_SAMPLE;
+	m_pcsamples.clear();
+	m_pcsample_total = 0;
+	m_pcsample_next = m_exec->total_cycles() + period;
+}
+
+
 //-------------------------------------------------
 //  hotspot_track - enable/disable tracking of
 //  hotspots
@@ -2772,6 +2810,23 @@ void device_debug::trace(FILE *file, bool trace_over, const char *action)
 }
 
 
+//-------------------------------------------------
+//  trace_binary - trace execution of a given
+//  device to a compact binary file
+//-------------------------------------------------
+
+void device_debug::trace_binary(core_file *file, const char *action)
+{
+	// delete any existing tracers
+	auto_free(m_device.machine(), m_trace);
+	m_trace = NULL;
+
+	// if we have a new file, make a new tracer
+	if (file != NULL)
+		m_trace = auto_alloc(m_device.machine(), tracer(*this, *file, action));
+}
+
+
 //-------------------------------------------------
 //  trace_printf - output data into the given
 //  device's tracefile, if tracing
@@ -2813,7 +2868,7 @@ void device_debug::compute_debug_flags()
 
 	// if we're tracking history, or we're hooked, or stepping, or stopping at a breakpoint
 	// make sure we call the hook
-	if ((m_flags & (DEBUG_FLAG_HISTORY | DEBUG_FLAG_HOOKED | DEBUG_FLAG_STEPPING_ANY | DEBUG_FLAG_STOP_PC | DEBUG_FLAG_LIVE_BP)) != 0)
+	if ((m_flags & (DEBUG_FLAG_HISTORY | DEBUG_FLAG_HOOKED | DEBUG_FLAG_STEPPING_ANY | DEBUG_FLAG_STOP_PC | DEBUG_FLAG_LIVE_BP | DEBUG_FLAG_PC_SAMPLE)) != 0)
 		machine.debug_flags |= DEBUG_FLAG_CALL_HOOK;
 
 	// also call if we are tracing
@@ -2867,6 +2922,15 @@ void device_debug::prepare_for_step_overout(offs_t pc)
 
 void device_debug::breakpoint_update_flags()
 {
+	// rebuild the address filter; disabled breakpoints are included too, since
+	// they can be re-enabled through breakpoint::setEnabled without coming here
+	memset(m_bpfilter, 0, sizeof(m_bpfilter));
+	for (breakpoint *bp = m_bplist; bp != NULL; bp = bp->m_next)
+	{
+		UINT32 bit = breakpoint_filter_bit(bp->m_address);
+		m_bpfilter[bit / 32] |= 1U << (bit % 32);
+	}
+
 	// see if there are any enabled breakpoints
 	m_flags &= ~DEBUG_FLAG_LIVE_BP;
 	for (breakpoint *bp = m_bplist; bp != NULL; bp = bp->m_next)
@@ -2902,23 +2966,25 @@ void device_debug::breakpoint_update_flags()
 
 void device_debug::breakpoint_check(offs_t pc)
 {
-	// see if we match
-	for (breakpoint *bp = m_bplist; bp != NULL; bp = bp->m_next)
-		if (bp->hit(pc))
-		{
-			// halt in the debugger by default
-			debugcpu_private *global = m_device.machine().debugcpu_data;
-			global->execution_state = EXECUTION_STATE_STOPPED;
+	// see if we match; most instructions can be rejected by the filter alone
+	UINT32 bit = breakpoint_filter_bit(pc);
+	if ((m_bpfilter[bit / 32] & (1U << (bit % 32))) != 0)
+		for (breakpoint *bp = m_bplist; bp != NULL; bp = bp->m_next)
+			if (bp->hit(pc))
+			{
+				// halt in the debugger by default
+				debugcpu_private *global = m_device.machine().debugcpu_data;
+				global->execution_state = EXECUTION_STATE_STOPPED;
 
-			// if we hit, evaluate the action
-			if (bp->m_action)
-				debug_console_execute_command(m_device.machine(), bp->m_action, 0);
+				// if we hit, evaluate the action
+				if (bp->m_action)
+					debug_console_execute_command(m_device.machine(), bp->m_action, 0);
 
-			// print a notification, unless the action made us go again
-			if (global->execution_state == EXECUTION_STATE_STOPPED)
-				debug_console_printf(m_device.machine(), "Stopped at breakpoint %X\n", bp->m_index);
-			break;
-		}
+				// print a notification, unless the action made us go again
+				if (global->execution_state == EXECUTION_STATE_STOPPED)
+					debug_console_printf(m_device.machine(), "Stopped at breakpoint %X\n", bp->m_index);
+				break;
+			}
 
 	// see if we have any matching registerpoints
 	for (registerpoint *rp = m_rplist; rp != NULL; rp = rp->m_next)
@@ -2953,25 +3019,20 @@ void device_debug::breakpoint_check(offs_t pc)
 
 void device_debug::watchpoint_update_flags(address_space &space)
 {
-	// if hotspots are enabled, turn on all reads
-	bool enableread = false;
-	if (m_hotspots.count() > 0)
-		enableread = true;
+	// start from scratch; if hotspots are enabled, turn on all reads
+	space.enable_read_watchpoints(m_hotspots.count() > 0);
+	space.enable_write_watchpoints(false);
 
-	// see if there are any enabled breakpoints
-	bool enablewrite = false;
+	// only the pages covered by enabled watchpoints need to be hooked
 	for (watchpoint *wp = m_wplist[space.spacenum()]; wp != NULL; wp = wp->m_next)
-		if (wp->m_enabled)
+		if (wp->m_enabled && wp->m_length != 0)
 		{
+			offs_t byteend = wp->m_address + wp->m_length - 1;
 			if (wp->m_type & WATCHPOINT_READ)
-				enableread = true;
+				space.enable_read_watchpoints(wp->m_address, byteend);
 			if (wp->m_type & WATCHPOINT_WRITE)
-				enablewrite = true;
+				space.enable_write_watchpoints(wp->m_address, byteend);
 		}
-
-	// push the flags out globally
-	space.enable_read_watchpoints(enableread);
-	space.enable_write_watchpoints(enablewrite);
 }
 
 
@@ -3415,7 +3476,11 @@ bool device_debug::registerpoint::hit()
 
 device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, const char *action)
 	: m_debug(debug),
-		m_file(file),
+		m_file(&file),
+		m_binfile(NULL),
+		m_binlength(0),
+		m_binpc(0),
+		m_binopbytes(0),
 		m_action((action != NULL) ? action : ""),
 		m_loops(0),
 		m_nextdex(0),
@@ -3425,6 +3490,38 @@ device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, c
 	memset(m_history, 0, sizeof(m_history));
 }
 
+device_debug::tracer::tracer(device_debug &debug, core_file &file, const char *action)
+	: m_debug(debug),
+		m_file(NULL),
+		m_binfile(&file),
+		m_binlength(0),
+		m_binpc(0),
+		m_binopbytes(debug.max_opcode_bytes()),
+		m_action((action != NULL) ? action : ""),
+		m_loops(0),
+		m_nextdex(0),
+		m_trace_over(false),
+		m_trace_over_target(~0)
+{
+	memset(m_history, 0, sizeof(m_history));
+
+	// the opcode cache starts out empty on both ends
+	m_binbuffer.resize(BINARY_BUFFER_SIZE);
+	m_bincache_pc.resize_and_clear(TRACEBIN_CACHE_SIZE, 0xff);
+	m_bincache_bytes.resize_and_clear(TRACEBIN_CACHE_SIZE * m_binopbytes);
+
+	// write the header: magic, version, opcode bytes, address width, then the tag and device shortname
+	const char *tag = debug.m_device.tag();
+	const char *shortname = debug.m_device.shortname();
+	UINT8 header[4] = { TRACEBIN_VERSION, UINT8(m_binopbytes), UINT8(debug.logaddrchars()), UINT8(strlen(tag)) };
+	core_fwrite(m_binfile, TRACEBIN_MAGIC, sizeof(TRACEBIN_MAGIC));
+	core_fwrite(m_binfile, header, sizeof(header));
+	core_fwrite(m_binfile, tag, header[3]);
+	UINT8 shortlen = strlen(shortname);
+	core_fwrite(m_binfile, &shortlen, 1);
+	core_fwrite(m_binfile, shortname, shortlen);
+}
+
 
 //-------------------------------------------------
 //  ~tracer - destructor
@@ -3433,7 +3530,15 @@ device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, c
 device_debug::tracer::~tracer()
 {
 	// make sure we close the file if we can
-	fclose(&m_file);
+	if (m_binfile != NULL)
+	{
+		if (m_loops != 0)
+			write_loops();
+		flush_binary();
+		core_fclose(m_binfile);
+	}
+	else
+		fclose(m_file);
 }
 
 
@@ -3465,9 +3570,16 @@ void device_debug::tracer::update(offs_t pc)
 		return;
 	}
 
+	// binary traces skip the disassembly entirely
+	if (m_binfile != NULL)
+	{
+		update_binary(pc);
+		return;
+	}
+
 	// if we just finished looping, indicate as much
 	if (m_loops != 0)
-		fprintf(&m_file, "\n   (loops for %d instructions)\n\n", m_loops);
+		fprintf(m_file, "\n   (loops for %d instructions)\n\n", m_loops);
 	m_loops = 0;
 
 	// execute any trace actions first
@@ -3485,7 +3597,7 @@ void device_debug::tracer::update(offs_t pc)
 	buffer.cat(dasm);
 
 	// output the result
-	fprintf(&m_file, "%s\n", buffer.cstr());
+	fprintf(m_file, "%s\n", buffer.cstr());
 
 	// do we need to step the trace over this instruction?
 	if (m_trace_over && (dasmresult & DASMFLAG_SUPPORTED) != 0 && (dasmresult & DASMFLAG_STEP_OVER) != 0)
@@ -3506,6 +3618,104 @@ void device_debug::tracer::update(offs_t pc)
 }
 
 
+//-------------------------------------------------
+//  update_binary - append a binary record for a
+//  given instruction; the opcode bytes are only
+//  written when they differ from the last time
+//  this PC's cache slot was logged
+//-------------------------------------------------
+
+void device_debug::tracer::update_binary(offs_t pc)
+{
+	// if we just finished looping, indicate as much
+	if (m_loops != 0)
+		write_loops();
+
+	// execute any trace actions first
+	if (m_action)
+		debug_console_execute_command(m_debug.m_device.machine(), m_action, 0);
+
+	// make sure there is room for a worst-case record
+	if (m_binlength + 1 + 5 + m_binopbytes > BINARY_BUFFER_SIZE)
+		flush_binary();
+
+	// fetch the opcode bytes
+	address_space &space = m_debug.m_memory->space(AS_PROGRAM);
+	offs_t pcbyte = space.address_to_byte(pc) & space.bytemask();
+	UINT8 opbuf[64];
+	for (int numbytes = 0; numbytes < m_binopbytes; numbytes++)
+		opbuf[numbytes] = debug_read_opcode(space, pcbyte + numbytes, 1, false);
+
+	// compare against the cache slot for this PC
+	int slot = tracebin_cache_index(pc);
+	UINT8 *cached = &m_bincache_bytes[slot * m_binopbytes];
+	bool hit = (m_bincache_pc[slot] == pc && memcmp(cached, opbuf, m_binopbytes) == 0);
+
+	// record type, then the zigzag-encoded PC delta
+	INT32 delta = pc - m_binpc;
+	m_binbuffer[m_binlength++] = hit ? TRACEBIN_INSN_CACHED : TRACEBIN_INSN;
+	write_varint((delta << 1) ^ (delta >> 31));
+	m_binpc = pc;
+
+	// on a miss, append the bytes and update the cache
+	if (!hit)
+	{
+		memcpy(&m_binbuffer[m_binlength], opbuf, m_binopbytes);
+		m_binlength += m_binopbytes;
+		m_bincache_pc[slot] = pc;
+		memcpy(cached, opbuf, m_binopbytes);
+	}
+
+	// log this PC
+	m_nextdex = (m_nextdex + 1) % TRACE_LOOPS;
+	m_history[m_nextdex] = pc;
+}
+
+
+//-------------------------------------------------
+//  write_loops - append a record for the number
+//  of instructions skipped in a loop
+//-------------------------------------------------
+
+void device_debug::tracer::write_loops()
+{
+	if (m_binlength + 1 + 5 > BINARY_BUFFER_SIZE)
+		flush_binary();
+	m_binbuffer[m_binlength++] = TRACEBIN_LOOPS;
+	write_varint(m_loops);
+	m_loops = 0;
+}
+
+
+//-------------------------------------------------
+//  write_varint - append a 7-bits-per-byte
+//  variable length value to the binary buffer
+//-------------------------------------------------
+
+void device_debug::tracer::write_varint(UINT32 value)
+{
+	while (value >= 0x80)
+	{
+		m_binbuffer[m_binlength++] = (value & 0x7f) | 0x80;
+		value >>= 7;
+	}
+	m_binbuffer[m_binlength++] = value;
+}
+
+
+//-------------------------------------------------
+//  flush_binary - hand pending binary records to
+//  the (compressing) output file
+//-------------------------------------------------
+
+void device_debug::tracer::flush_binary()
+{
+	if (m_binlength != 0)
+		core_fwrite(m_binfile, m_binbuffer, m_binlength);
+	m_binlength = 0;
+}
+
+
 //-------------------------------------------------
 //  vprintf - generic print to the trace file
 //-------------------------------------------------
@@ -3513,7 +3723,21 @@ void device_debug::tracer::update(offs_t pc)
 void device_debug::tracer::vprintf(const char *format, va_list va)
 {
 	// pass through to the file
-	vfprintf(&m_file, format, va);
+	if (m_binfile == NULL)
+	{
+		vfprintf(m_file, format, va);
+		return;
+	}
+
+	// binary traces wrap the text in a record of its own
+	astring text;
+	text.vprintf(format, va);
+	if (m_binlength + 1 + 5 > BINARY_BUFFER_SIZE)
+		flush_binary();
+	m_binbuffer[m_binlength++] = TRACEBIN_TEXT;
+	write_varint(text.len());
+	flush_binary();
+	core_fwrite(m_binfile, text.cstr(), text.len());
 }
 
 
@@ -3524,7 +3748,10 @@ void device_debug::tracer::vprintf(const char *format, va_list va)
 
 void device_debug::tracer::flush()
 {
-	fflush(&m_file);
+	if (m_binfile != NULL)
+		flush_binary();
+	else
+		fflush(m_file);
 }
 
 
@@ -15,6 +15,7 @@
 
 #include "express.h"
 #include "simple_set.h"
+#include <map>
 
 
 //**************************************************************************
@@ -27,6 +28,20 @@ const UINT8 WATCHPOINT_READWRITE        = WATCHPOINT_READ | WATCHPOINT_WRITE;
 
 const int COMMENT_VERSION               = 1;
 
+// binary trace files, as written by the 'tracebin' command
+const char TRACEBIN_MAGIC[]             = "MAMETRC";
+const UINT8 TRACEBIN_VERSION            = 1;
+const int TRACEBIN_CACHE_SIZE           = 4096;
+
+// binary trace record types
+const UINT8 TRACEBIN_INSN               = 0;    // PC delta, followed by the raw opcode bytes
+const UINT8 TRACEBIN_INSN_CACHED        = 1;    // PC delta, opcode bytes same as last time at this PC
+const UINT8 TRACEBIN_LOOPS              = 2;    // count of instructions skipped in a loop
+const UINT8 TRACEBIN_TEXT               = 3;    // length, followed by text from tracelog
+
+// opcode cache slot for a PC; writers and readers must agree on this
+inline int tracebin_cache_index(offs_t pc) { return (pc ^ (pc >> 12)) & (TRACEBIN_CACHE_SIZE - 1); }
+
 
 
 //**************************************************************************
@@ -235,6 +250,13 @@ public:
 	bool hotspot_tracking_enabled() const { return (m_hotspots != NULL); }
 	void hotspot_track(int numspots, int threshhold);
 
+	// PC sampling
+	typedef std::map<offs_t, UINT32> pc_sample_map;
+	bool pc_sampling_enabled() const { return (m_pcsample_period != 0); }
+	void pc_sample(UINT64 period);
+	const pc_sample_map &pc_samples() const { return m_pcsamples; }
+	UINT32 pc_sample_total() const { return m_pcsample_total; }
+
 	// comments
 	void comment_add(offs_t address, const char *comment, rgb_t color);
 	bool comment_remove(offs_t addr);
@@ -263,6 +285,7 @@ public:
 
 	// tracing
 	void trace(FILE *file, bool trace_over, const char *action);
+	void trace_binary(core_file *file, const char *action);
 	void trace_printf(const char *fmt, ...) ATTR_PRINTF(2,3);
 	void trace_flush() { if (m_trace != NULL) m_trace->flush(); }
 
@@ -270,6 +293,9 @@ public:
 
 	static const int HISTORY_SIZE = 256;
 
+	// breakpoint address filter
+	static const int BPFILTER_BITS = 1024;
+
 private:
 	// internal helpers
 	void compute_debug_flags();
@@ -279,6 +305,7 @@ private:
 	// breakpoint and watchpoint helpers
 	void breakpoint_update_flags();
 	void breakpoint_check(offs_t pc);
+	static UINT32 breakpoint_filter_bit(offs_t pc) { return (pc ^ (pc >> 10)) & (BPFILTER_BITS - 1); }
 	void watchpoint_update_flags(address_space &space);
 	void watchpoint_check(address_space &space, int type, offs_t address, UINT64 value_to_write, UINT64 mem_mask);
 	void hotspot_check(address_space &space, offs_t address);
@@ -328,6 +355,7 @@ private:
 
 	// breakpoints and watchpoints
 	breakpoint *            m_bplist;                   // list of breakpoints
+	UINT32                  m_bpfilter[BPFILTER_BITS / 32]; // hashed addresses of all breakpoints
 	watchpoint *            m_wplist[ADDRESS_SPACES];   // watchpoint lists for each address space
 	registerpoint *         m_rplist;                   // list of registerpoints
 
@@ -336,6 +364,7 @@ private:
 	{
 	public:
 		tracer(device_debug &debug, FILE &file, bool trace_over, const char *action);
+		tracer(device_debug &debug, core_file &file, const char *action);
 		~tracer();
 
 		void update(offs_t pc);
@@ -344,9 +373,22 @@ private:
 
 	private:
 		static const int TRACE_LOOPS = 64;
+		static const int BINARY_BUFFER_SIZE = 65536;
+
+		void update_binary(offs_t pc);
+		void write_loops();
+		void write_varint(UINT32 value);
+		void flush_binary();
 
 		device_debug &      m_debug;                    // reference to our owner
-		FILE &              m_file;                     // tracing file for this CPU
+		FILE *              m_file;                     // text tracing file for this CPU
+		core_file *         m_binfile;                  // binary tracing file for this CPU
+		dynamic_array<UINT8> m_binbuffer;               // pending binary records
+		UINT32              m_binlength;                // number of bytes pending in m_binbuffer
+		offs_t              m_binpc;                    // PC of the last binary record
+		int                 m_binopbytes;               // opcode bytes logged per instruction
+		dynamic_array<offs_t> m_bincache_pc;            // PC last logged in each cache slot
+		dynamic_array<UINT8> m_bincache_bytes;          // opcode bytes last logged in each cache slot
 		astring             m_action;                   // action to perform during a trace
 		offs_t              m_history[TRACE_LOOPS];     // history of recent PCs
 		int                 m_loops;                    // number of instructions in a loop
@@ -369,6 +411,12 @@ private:
 	dynamic_array<hotspot_entry> m_hotspots;            // hotspot list
 	int                     m_hotspot_threshhold;       // threshhold for the number of hits to print
 
+	// PC sampling
+	UINT64                  m_pcsample_period;          // cycles between samples (0 = off)
+	UINT64                  m_pcsample_next;            // total cycle count of the next sample
+	UINT32                  m_pcsample_total;           // total number of samples taken
+	pc_sample_map           m_pcsamples;                // sample count for each PC
+
 	// pc tracking
 	class dasm_pc_tag
 	{
@@ -442,6 +490,7 @@ private:
 	static const UINT32 DEBUG_FLAG_STOP_VBLANK      = 0x00001000;       // there is a pending stop on the next VBLANK
 	static const UINT32 DEBUG_FLAG_STOP_TIME        = 0x00002000;       // there is a pending stop at cpu->stoptime
 	static const UINT32 DEBUG_FLAG_LIVE_BP          = 0x00010000;       // there are live breakpoints for this CPU
+	static const UINT32 DEBUG_FLAG_PC_SAMPLE        = 0x00020000;       // sampling this CPU's PC
 
 	static const UINT32 DEBUG_FLAG_STEPPING_ANY     = DEBUG_FLAG_STEPPING | DEBUG_FLAG_STEPPING_OVER | DEBUG_FLAG_STEPPING_OUT;
 	static const UINT32 DEBUG_FLAG_TRACING_ANY      = DEBUG_FLAG_TRACING | DEBUG_FLAG_TRACING_OVER;
@@ -143,6 +143,7 @@ static const help_item static_help_list[] =
 		"  observe [<cpu>[,<cpu>[,...]]] -- resumes debugging on <cpu>\n"
 		"  trace {<filename>|OFF}[,<cpu>[,<action>]] -- trace the given CPU to a file (defaults to active CPU)\n"
 		"  traceover {<filename>|OFF}[,<cpu>[,<action>]] -- trace the given CPU to a file, but skip subroutines (defaults to active CPU)\n"
+		"  tracebin {<filename>|OFF}[,<cpu>[,<action>]] -- trace the given CPU to a compressed binary file (defaults to active CPU)\n"
 		"  traceflush -- flushes all open trace files\n"
 	},
 	{
@@ -171,6 +172,8 @@ static const help_item static_help_list[] =
 		"  wpenable [<wpnum>] -- enables a given watchpoint or all if no <wpnum> specified\n"
 		"  wplist -- lists all the watchpoints\n"
 		"  hotspot [<cpu>,[<depth>[,<hits>]]] -- attempt to find hotspots\n"
+		"  pcsample [<cpu>[,<cycles>]] -- sample the PC of <cpu> every <cycles> cycles\n"
+		"  pcsamplist [<cpu>[,<count>[,<filename>]]] -- lists the most frequently sampled PCs\n"
 	},
 	{
 		"registerpoints",
@@ -846,6 +849,26 @@ static const help_item static_help_list[] =
 		"  Begin tracing the execution of CPU #0, logging output to asteroid.tr. Before each line, "
 		"output A=<aval> to the tracelog.\n"
 	},
+	{
+		"tracebin",
+		"\n"
+		"  tracebin {<filename>|OFF}[,<cpu>[,<action>]]\n"
+		"\n"
+		"Starts or stops tracing of the execution of the specified <cpu> to a compressed binary file. "
+		"Instead of a line of disassembly, each instruction is logged as its PC and raw opcode bytes, "
+		"which makes tracing much faster and the files much smaller. Use 'unidasm -trace' to "
+		"disassemble the file afterwards. The parameters are the same as for the 'trace' command, "
+		"except that binary traces cannot be appended to an existing file. Any 'tracelog' output is "
+		"stored in the file alongside the instructions.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"tracebin joust.trb\n"
+		"  Begin tracing the currently active CPU, logging output to joust.trb.\n"
+		"\n"
+		"tracebin off\n"
+		"  Turn off tracing on the currently active CPU.\n"
+	},
 	{
 		"traceover",
 		"\n"
@@ -1110,6 +1133,47 @@ static const help_item static_help_list[] =
 		"  Looks for hotspots on CPU 1 using a search buffer of 64 entries, reporting any entries which "
 		"end up with 1000 or more hits.\n"
 	},
+	{
+		"pcsample",
+		"\n"
+		"  pcsample [<cpu>[,<cycles>]]\n"
+		"\n"
+		"The pcsample command records where the code running on <cpu> spends its time. <cpu> defaults "
+		"to the currently active CPU. <cycles>, which defaults to 1000, sets how often the PC is sampled. "
+		"Each sample goes to the instruction that is about to run when the cycle count passes the next "
+		"sample point; an instruction that spans several periods counts as several samples. Starting a new sampler discards the "
+		"previous results. Use pcsamplist to view the results. Running pcsample with no parameters "
+		"stops all active samplers and keeps their results.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"pcsample 0\n"
+		"  Samples the PC of CPU 0 every 1000 cycles.\n"
+		"\n"
+		"pcsample 1,#100\n"
+		"  Samples the PC of CPU 1 every 100 cycles.\n"
+		"\n"
+		"pcsample\n"
+		"  Stops all PC sampling.\n"
+	},
+	{
+		"pcsamplist",
+		"\n"
+		"  pcsamplist [<cpu>[,<count>[,<filename>]]]\n"
+		"\n"
+		"The pcsamplist command lists the <count> most frequently sampled PCs on <cpu>, busiest first. "
+		"Each line shows the percentage of samples, the sample count and the disassembly at that PC. "
+		"<cpu> defaults to the currently active CPU. <count> defaults to 20; 0 lists every sampled PC. "
+		"If <filename> is given, the list is written to that file instead of the console.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"pcsamplist\n"
+		"  Lists the 20 busiest PCs of the currently active CPU.\n"
+		"\n"
+		"pcsamplist 0,0,profile.txt\n"
+		"  Writes all sampled PCs of CPU 0 to profile.txt.\n"
+	},
 	{
 		"rpset",
 		"\n"
@@ -46,8 +46,13 @@ void debugger_flush_all_traces_on_abnormal_exit(void);
 INLINE void debugger_instruction_hook(device_t *device, offs_t curpc)
 {
 #ifndef MAME_DEBUG_FAST
-	if ((device->machine().debug_flags & DEBUG_FLAG_CALL_HOOK) != 0)
-		device->debug()->instruction_hook(curpc);
+	if ((device->machine().debug_flags & (DEBUG_FLAG_CALL_HOOK | DEBUG_FLAG_IDLE_DETECT)) != 0)
+	{
+		if ((device->machine().debug_flags & DEBUG_FLAG_CALL_HOOK) != 0)
+			device->debug()->instruction_hook(curpc);
+		else
+			device->execute().idle_detect_hook(curpc);
+	}
 #endif
 }
 
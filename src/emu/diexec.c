@@ -64,7 +64,12 @@ device_execute_interface::device_execute_interface(const machine_config &mconfig
 		m_divisor(0),
 		m_divshift(0),
 		m_cycles_per_second(0),
-		m_attoseconds_per_cycle(0)
+		m_attoseconds_per_cycle(0),
+		m_idle_detect(false),
+		m_idle_lastpc(~0),
+		m_idle_looppc(~0),
+		m_idle_hash(0),
+		m_idle_reportedpc(~0)
 {
 	memset(&m_localtime, 0, sizeof(m_localtime));
 
@@ -357,6 +362,63 @@ UINT64 device_execute_interface::total_cycles() const
 }
 
 
+//-------------------------------------------------
+//  idle_detect_check - look for a short loop
+//  that makes two passes in a row without
+//  changing any CPU state; such a loop can only
+//  be waiting on memory or an interrupt, so the
+//  rest of the timeslice is skipped
+//-------------------------------------------------
+
+void device_execute_interface::idle_detect_check(offs_t curpc)
+{
+	// only a short backward (or self) branch can close a loop
+	offs_t lastpc = m_idle_lastpc;
+	m_idle_lastpc = curpc;
+	if (curpc > lastpc || lastpc - curpc > IDLE_LOOP_MAX_LENGTH)
+		return;
+
+	// on the first pass, or if anything changed, just remember the state
+	UINT64 hash = idle_state_hash();
+	if (curpc != m_idle_looppc || hash != m_idle_hash)
+	{
+		m_idle_looppc = curpc;
+		m_idle_hash = hash;
+		return;
+	}
+
+	// log each new idle loop once
+	if (curpc != m_idle_reportedpc)
+	{
+		mame_printf_verbose("%s: idle loop detected at %X, skipping to the end of each timeslice\n", device().tag(), curpc);
+		m_idle_reportedpc = curpc;
+	}
+
+	// eat the rest of the timeslice; the next one must make a full pass again
+	m_idle_looppc = ~0;
+	eat_cycles(cycles_remaining());
+}
+
+
+//-------------------------------------------------
+//  idle_state_hash - compute a hash of all the
+//  state the device exposes
+//-------------------------------------------------
+
+UINT64 device_execute_interface::idle_state_hash()
+{
+	device_state_interface *state;
+	if (!device().interface(state))
+		return 0;
+
+	UINT64 hash = 0;
+	for (const device_state_entry *entry = state->state_first(); entry != NULL; entry = entry->next())
+		if (!entry->divider())
+			hash = (hash * 31) ^ state->state_int(entry->index());
+	return hash;
+}
+
+
 //-------------------------------------------------
 //  execute_clocks_to_cycles - convert the number
 //  of clocks to cycles, rounding down if necessary
@@ -500,6 +562,26 @@ void device_execute_interface::interface_pre_start()
 	if (m_timed_interrupt_period != attotime::zero)
 		m_timedint_timer = device().machine().scheduler().timer_alloc(FUNC(static_trigger_periodic_interrupt), (void *)this);
 
+	// opt in to idle loop detection if our tag was listed; the debugger's own hook takes precedence
+	device_state_interface *state;
+	const char *idletags = device().machine().options().idle_detect();
+	if (idletags != NULL && idletags[0] != 0 && device().interface(state))
+	{
+		const char *tag = device().tag();
+		if (tag[0] == ':')
+			tag++;
+		for (const char *cur = idletags; *cur != 0; )
+		{
+			const char *end = strchr(cur, ',');
+			int length = (end != NULL) ? end - cur : strlen(cur);
+			if (length == strlen(tag) && core_strnicmp(cur, tag, length) == 0)
+				m_idle_detect = true;
+			cur += (end != NULL) ? length + 1 : length;
+		}
+		if (m_idle_detect && (device().machine().debug_flags & DEBUG_FLAG_ENABLED) == 0)
+			device().machine().debug_flags |= DEBUG_FLAG_IDLE_DETECT;
+	}
+
 	// register for save states
 	device().save_item(NAME(m_suspend));
 	device().save_item(NAME(m_nextsuspend));
@@ -552,6 +634,9 @@ void device_execute_interface::interface_post_reset()
 	for (int line = 0; line < ARRAY_LENGTH(m_input); line++)
 		m_input[line].reset();
 
+	// forget any loop we were watching
+	m_idle_lastpc = m_idle_looppc = ~0;
+
 	// reconfingure VBLANK interrupts
 	if (m_vblank_interrupt_screen != NULL)
 	{
@@ -183,6 +183,9 @@ public:
 	attotime local_time() const;
 	UINT64 total_cycles() const;
 
+	// idle loop detection, called per instruction when DEBUG_FLAG_IDLE_DETECT is set
+	void idle_detect_hook(offs_t curpc) { if (m_idle_detect) idle_detect_check(curpc); }
+
 	// required operation overrides
 	void run() { execute_run(); }
 
@@ -290,7 +293,19 @@ protected:
 	UINT32                  m_cycles_per_second;        // cycles per second, adjusted for multipliers
 	attoseconds_t           m_attoseconds_per_cycle;    // attoseconds per adjusted clock cycle
 
+	// idle loop detection
+	static const int IDLE_LOOP_MAX_LENGTH = 32;         // longest backward branch considered a loop
+	bool                    m_idle_detect;              // true if idle loop detection is enabled
+	offs_t                  m_idle_lastpc;              // PC of the previous instruction
+	offs_t                  m_idle_looppc;              // head of the loop being watched
+	UINT64                  m_idle_hash;                // state hash at the last pass through m_idle_looppc
+	offs_t                  m_idle_reportedpc;          // last loop head reported to the log
+
 private:
+	// idle loop helpers
+	void idle_detect_check(offs_t curpc);
+	UINT64 idle_state_hash();
+
 	// callbacks
 	static void static_timed_trigger_callback(running_machine &machine, void *ptr, int param);
 
@@ -40,6 +40,32 @@ static inline int readbit(const UINT8 *src, unsigned int bitnum)
 }
 
 
+/*-------------------------------------------------
+    transtable_mode - return the single DRAWMODE_*
+    value a pen table selects for every pen an
+    element uses, or -1 if the pens differ or pen
+    usage is not tracked
+-------------------------------------------------*/
+
+static inline int transtable_mode(gfx_element &gfx, UINT32 code, const UINT8 *pentable)
+{
+	if (!gfx.has_pen_usage())
+		return -1;
+
+	int mode = -1;
+	UINT32 usage = gfx.pen_usage(code);
+	for (int pen = 0; usage != 0; pen++, usage >>= 1)
+		if (usage & 1)
+		{
+			if (mode == -1)
+				mode = pentable[pen];
+			else if (mode != pentable[pen])
+				return -1;
+		}
+	return mode;
+}
+
+
 /*-------------------------------------------------
     normalize_xscroll - normalize an X scroll
     value for a bitmap to be positive and less
@@ -353,6 +379,7 @@ gfx_element::gfx_element()
 		m_dirtyseq(1),
 		m_gfxdata(NULL),
 		m_layout_is_raw(false),
+		m_layout_is_bytewise(false),
 		m_layout_planes(0),
 		m_layout_charincrement(0)
 {
@@ -377,6 +404,7 @@ gfx_element::gfx_element(palette_device *palette, UINT8 *base, UINT32 width, UIN
 		m_dirtyseq(1),
 		m_gfxdata(base),
 		m_layout_is_raw(true),
+		m_layout_is_bytewise(false),
 		m_layout_planes(0),
 		m_layout_charincrement(0)
 {
@@ -401,6 +429,7 @@ gfx_element::gfx_element(palette_device *palette, const gfx_layout &gl, const UI
 		m_dirtyseq(1),
 		m_gfxdata(NULL),
 		m_layout_is_raw(false),
+		m_layout_is_bytewise(false),
 		m_layout_planes(0),
 		m_layout_charincrement(0)
 {
@@ -454,6 +483,19 @@ void gfx_element::set_layout(const gfx_layout &gl, const UINT8 *srcdata)
 		for (int x = 0; x < m_width; x++)
 			m_layout_xoffset[x] = gl.xoffs(x);
 
+		// determine if each group of 8 pixels in a plane row is a single source byte,
+		// in which case decode() can fetch whole bytes instead of individual bits
+		m_layout_is_bytewise = ((m_width % 8) == 0 && (m_layout_charincrement % 8) == 0);
+		for (int p = 0; p < m_layout_planes && m_layout_is_bytewise; p++)
+			if ((m_layout_planeoffset[p] % 8) != 0)
+				m_layout_is_bytewise = false;
+		for (int y = 0; y < m_height && m_layout_is_bytewise; y++)
+			if ((m_layout_yoffset[y] % 8) != 0)
+				m_layout_is_bytewise = false;
+		for (int x = 0; x < m_width && m_layout_is_bytewise; x++)
+			if ((m_layout_xoffset[x & ~7] % 8) != 0 || m_layout_xoffset[x] != m_layout_xoffset[x & ~7] + (x & 7))
+				m_layout_is_bytewise = false;
+
 		// we get to pick our own modulos
 		m_line_modulo = m_origwidth;
 		m_char_modulo = m_line_modulo * m_origheight;
@@ -539,10 +581,26 @@ void gfx_element::decode(UINT32 code)
 				int yoffs = planeoffs + m_layout_yoffset[y];
 				UINT8 *dp = decode_base + y * rowbytes();
 
+				// fast case: fetch 8 pixels' worth of this plane at a time
+				if (m_layout_is_bytewise)
+				{
+					for (int x = 0; x < m_origwidth; x += 8)
+					{
+						UINT8 bits = m_srcdata[(yoffs + m_layout_xoffset[x]) / 8];
+						if (bits != 0)
+							for (int bit = 0; bit < 8; bit++)
+								if (bits & (0x80 >> bit))
+									dp[x + bit] |= planebit;
+					}
+				}
+
 				// iterate over columns
-				for (int x = 0; x < m_origwidth; x++)
-					if (readbit(m_srcdata, yoffs + m_layout_xoffset[x]))
-						dp[x] |= planebit;
+				else
+				{
+					for (int x = 0; x < m_origwidth; x++)
+						if (readbit(m_srcdata, yoffs + m_layout_xoffset[x]))
+							dp[x] |= planebit;
+				}
 			}
 		}
 	}
@@ -770,9 +828,20 @@ void gfx_element::transtable(palette_device &palette, bitmap_ind16 &dest, const
 {
 	assert(pentable != NULL);
 
+	// use pen usage to optimize
+	code %= elements();
+	int mode = transtable_mode(*this, code, pentable);
+
+	// fully transparent; do nothing
+	if (mode == DRAWMODE_NONE)
+		return;
+
+	// fully opaque; draw as such
+	if (mode == DRAWMODE_SOURCE)
+		return opaque(palette, dest, cliprect, code, color, flipx, flipy, destx, desty);
+
 	// render
 	color = colorbase() + granularity() * (color % colors());
-	code %= elements();
 	DECLARE_NO_PRIORITY;
 	DRAWGFX_CORE(UINT16, PIXEL_OP_REBASE_TRANSTABLE16, NO_PRIORITY);
 }
@@ -783,9 +852,20 @@ void gfx_element::transtable(palette_device &palette, bitmap_rgb32 &dest, const
 {
 	assert(pentable != NULL);
 
+	// use pen usage to optimize
+	code %= elements();
+	int mode = transtable_mode(*this, code, pentable);
+
+	// fully transparent; do nothing
+	if (mode == DRAWMODE_NONE)
+		return;
+
+	// fully opaque; draw as such
+	if (mode == DRAWMODE_SOURCE)
+		return opaque(palette, dest, cliprect, code, color, flipx, flipy, destx, desty);
+
 	// render
 	const pen_t *paldata = &palette.pen(colorbase() + granularity() * (color % colors()));
-	code %= elements();
 	DECLARE_NO_PRIORITY;
 	DRAWGFX_CORE(UINT32, PIXEL_OP_REMAP_TRANSTABLE32, NO_PRIORITY);
 }
@@ -1058,9 +1138,20 @@ void gfx_element::zoom_transtable(palette_device &palette, bitmap_ind16 &dest, c
 	if (scalex == 0x10000 && scaley == 0x10000)
 		return transtable(palette, dest, cliprect, code, color, flipx, flipy, destx, desty, pentable, shadowtable);
 
+	// use pen usage to optimize
+	code %= elements();
+	int mode = transtable_mode(*this, code, pentable);
+
+	// fully transparent; do nothing
+	if (mode == DRAWMODE_NONE)
+		return;
+
+	// fully opaque; draw as such
+	if (mode == DRAWMODE_SOURCE)
+		return zoom_opaque(palette, dest, cliprect, code, color, flipx, flipy, destx, desty, scalex, scaley);
+
 	// render
 	color = colorbase() + granularity() * (color % colors());
-	code %= elements();
 	DECLARE_NO_PRIORITY;
 	DRAWGFXZOOM_CORE(UINT16, PIXEL_OP_REBASE_TRANSTABLE16, NO_PRIORITY);
 }
@@ -1075,9 +1166,20 @@ void gfx_element::zoom_transtable(palette_device &palette, bitmap_rgb32 &dest, c
 	if (scalex == 0x10000 && scaley == 0x10000)
 		return transtable(palette, dest, cliprect, code, color, flipx, flipy, destx, desty, pentable, shadowtable);
 
+	// use pen usage to optimize
+	code %= elements();
+	int mode = transtable_mode(*this, code, pentable);
+
+	// fully transparent; do nothing
+	if (mode == DRAWMODE_NONE)
+		return;
+
+	// fully opaque; draw as such
+	if (mode == DRAWMODE_SOURCE)
+		return zoom_opaque(palette, dest, cliprect, code, color, flipx, flipy, destx, desty, scalex, scaley);
+
 	// render
 	const pen_t *paldata = &palette.pen(colorbase() + granularity() * (color % colors()));
-	code %= elements();
 	DECLARE_NO_PRIORITY;
 	DRAWGFXZOOM_CORE(UINT32, PIXEL_OP_REMAP_TRANSTABLE32, NO_PRIORITY);
 }
@@ -1340,9 +1442,20 @@ void gfx_element::prio_transtable(palette_device &palette, bitmap_ind16 &dest, c
 	// high bit of the mask is implicitly on
 	pmask |= 1 << 31;
 
+	// use pen usage to optimize
+	code %= elements();
+	int mode = transtable_mode(*this, code, pentable);
+
+	// fully transparent; do nothing
+	if (mode == DRAWMODE_NONE)
+		return;
+
+	// fully opaque; draw as such
+	if (mode == DRAWMODE_SOURCE)
+		return prio_opaque(palette, dest, cliprect, code, color, flipx, flipy, destx, desty, priority, pmask);
+
 	// render
 	color = colorbase() + granularity() * (color % colors());
-	code %= elements();
 	DRAWGFX_CORE(UINT16, PIXEL_OP_REBASE_TRANSTABLE16_PRIORITY, UINT8);
 }
 
@@ -1355,9 +1468,20 @@ void gfx_element::prio_transtable(palette_device &palette, bitmap_rgb32 &dest, c
 	// high bit of the mask is implicitly on
 	pmask |= 1 << 31;
 
+	// use pen usage to optimize
+	code %= elements();
+	int mode = transtable_mode(*this, code, pentable);
+
+	// fully transparent; do nothing
+	if (mode == DRAWMODE_NONE)
+		return;
+
+	// fully opaque; draw as such
+	if (mode == DRAWMODE_SOURCE)
+		return prio_opaque(palette, dest, cliprect, code, color, flipx, flipy, destx, desty, priority, pmask);
+
 	// render
 	const pen_t *paldata = &palette.pen(colorbase() + granularity() * (color % colors()));
-	code %= elements();
 	DRAWGFX_CORE(UINT32, PIXEL_OP_REMAP_TRANSTABLE32_PRIORITY, UINT8);
 }
 
@@ -1663,9 +1787,20 @@ void gfx_element::prio_zoom_transtable(palette_device &palette, bitmap_ind16 &de
 	// high bit of the mask is implicitly on
 	pmask |= 1 << 31;
 
+	// use pen usage to optimize
+	code %= elements();
+	int mode = transtable_mode(*this, code, pentable);
+
+	// fully transparent; do nothing
+	if (mode == DRAWMODE_NONE)
+		return;
+
+	// fully opaque; draw as such
+	if (mode == DRAWMODE_SOURCE)
+		return prio_zoom_opaque(palette, dest, cliprect, code, color, flipx, flipy, destx, desty, scalex, scaley, priority, pmask);
+
 	// render
 	color = colorbase() + granularity() * (color % colors());
-	code %= elements();
 	DRAWGFXZOOM_CORE(UINT16, PIXEL_OP_REBASE_TRANSTABLE16_PRIORITY, UINT8);
 }
 
@@ -1683,9 +1818,20 @@ void gfx_element::prio_zoom_transtable(palette_device &palette, bitmap_rgb32 &de
 	// high bit of the mask is implicitly on
 	pmask |= 1 << 31;
 
+	// use pen usage to optimize
+	code %= elements();
+	int mode = transtable_mode(*this, code, pentable);
+
+	// fully transparent; do nothing
+	if (mode == DRAWMODE_NONE)
+		return;
+
+	// fully opaque; draw as such
+	if (mode == DRAWMODE_SOURCE)
+		return prio_zoom_opaque(palette, dest, cliprect, code, color, flipx, flipy, destx, desty, scalex, scaley, priority, pmask);
+
 	// render
 	const pen_t *paldata = &palette.pen(colorbase() + granularity() * (color % colors()));
-	code %= elements();
 	DRAWGFXZOOM_CORE(UINT32, PIXEL_OP_REMAP_TRANSTABLE32_PRIORITY, UINT8);
 }
 
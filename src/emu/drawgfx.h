@@ -275,6 +275,7 @@ private:
 	dynamic_array<UINT32> m_pen_usage;      // bitmask of pens that are used (pens 0-31 only)
 
 	bool            m_layout_is_raw;        // raw layout?
+	bool            m_layout_is_bytewise;   // every 8 pixels of a plane row come from one source byte?
 	UINT8           m_layout_planes;        // bit planes in the layout
 	UINT32          m_layout_charincrement; // per-character increment in source data
 	dynamic_array<UINT32> m_layout_planeoffset;// plane offsets
@@ -20,6 +20,16 @@
 
 
 
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+// arena blocks are carved up in this granularity
+const size_t ARENA_BLOCK_SIZE = 64 * 1024;
+const size_t ARENA_ALIGN = 16;
+
+
+
 //**************************************************************************
 //  GLOBALS
 //**************************************************************************
@@ -39,10 +49,13 @@ UINT64 resource_pool::s_id = 0;
 
 resource_pool::resource_pool(int hash_size)
 	: m_hash_size(hash_size),
+		m_count(0),
 		m_listlock(osd_lock_alloc()),
 		m_hash(hash_size, 0),
 		m_ordered_head(NULL),
-		m_ordered_tail(NULL)
+		m_ordered_tail(NULL),
+		m_arena_enabled(false),
+		m_arena(NULL)
 {
 }
 
@@ -69,44 +82,27 @@ void resource_pool::add(resource_pool_item &item, size_t size, const char *type)
 {
 	osd_lock_acquire(m_listlock);
 
+	// grow the hash table once the chains get long
+	if (++m_count > m_hash_size * 2)
+		rehash(m_hash_size * 2 + 1);
+
 	// insert into hash table
 	int hashval = reinterpret_cast<FPTR>(item.m_ptr) % m_hash_size;
 	item.m_next = m_hash[hashval];
 	m_hash[hashval] = &item;
 
-	// fetch the ID of this item's pointer; some implementations put hidden data
-	// before, so if we don't find it, check 4 bytes ahead
+	// IDs only ever increase, so the new item always goes at the tail
 	item.m_id = ++s_id;
 	if (LOG_ALLOCS)
 		fprintf(stderr, "#%06d, add %s, %d bytes\n", (UINT32)item.m_id, type, UINT32(size));
 
-	// find the entry to insert after
-	resource_pool_item *insert_after;
-	for (insert_after = m_ordered_tail; insert_after != NULL; insert_after = insert_after->m_ordered_prev)
-		if (insert_after->m_id < item.m_id)
-			break;
-
-	// insert into the appropriate spot
-	if (insert_after != NULL)
-	{
-		item.m_ordered_next = insert_after->m_ordered_next;
-		if (item.m_ordered_next != NULL)
-			item.m_ordered_next->m_ordered_prev = &item;
-		else
-			m_ordered_tail = &item;
-		item.m_ordered_prev = insert_after;
-		insert_after->m_ordered_next = &item;
-	}
+	item.m_ordered_next = NULL;
+	item.m_ordered_prev = m_ordered_tail;
+	if (m_ordered_tail != NULL)
+		m_ordered_tail->m_ordered_next = &item;
 	else
-	{
-		item.m_ordered_next = m_ordered_head;
-		if (item.m_ordered_next != NULL)
-			item.m_ordered_next->m_ordered_prev = &item;
-		else
-			m_ordered_tail = &item;
-		item.m_ordered_prev = NULL;
 		m_ordered_head = &item;
-	}
+	m_ordered_tail = &item;
 
 	osd_lock_release(m_listlock);
 }
@@ -146,10 +142,14 @@ void resource_pool::remove(void *ptr)
 			else
 				m_ordered_tail = deleteme->m_ordered_prev;
 
-			// delete the object and break
+			// delete the object and break; arena items only need destructing
 			if (LOG_ALLOCS)
 				fprintf(stderr, "#%06d, delete %d bytes\n", (UINT32)deleteme->m_id, static_cast<UINT32>(deleteme->m_size));
-			global_free(deleteme);
+			m_count--;
+			if (deleteme->m_arena)
+				deleteme->~resource_pool_item();
+			else
+				global_free(deleteme);
 			break;
 		}
 
@@ -221,5 +221,146 @@ void resource_pool::clear()
 	while (m_ordered_head != NULL)
 		remove(m_ordered_head->m_ptr);
 
+	// with everything destructed, the arena can go in one go
+	arena_free_all();
+
+	osd_lock_release(m_listlock);
+}
+
+
+//-------------------------------------------------
+//  alloc_memory - allocate memory for an object
+//  that is about to be added via pool_alloc
+//-------------------------------------------------
+
+void *resource_pool::alloc_memory(size_t size, const char *file, int line, bool clear)
+{
+	if (!m_arena_enabled)
+		return malloc_file_line(size, file, line, false, true, clear);
+
+	void *result = arena_alloc(size);
+	if (clear)
+		memset(result, 0, size);
+
+	// tag it so add_object knows where it came from; constructors can nest
+	// further pool_allocs, so tags are claimed newest first
+	osd_lock_acquire(m_listlock);
+	m_arena_pending.append(result);
+	osd_lock_release(m_listlock);
+	return result;
+}
+
+
+//-------------------------------------------------
+//  free_memory - release memory from
+//  alloc_memory whose constructor threw
+//-------------------------------------------------
+
+void resource_pool::free_memory(void *ptr, const char *file, int line)
+{
+	// arena memory is simply abandoned until the pool is cleared
+	if (m_arena_pending.count() == 0 || !arena_claim(ptr))
+		free_file_line(ptr, file, line, false);
+}
+
+
+//-------------------------------------------------
+//  arena_alloc - bump-allocate from the arena
+//-------------------------------------------------
+
+void *resource_pool::arena_alloc(size_t size)
+{
+	size = (size + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+	size_t header = (sizeof(arena_block) + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+
+	osd_lock_acquire(m_listlock);
+
+	// fast path: room left in the current block
+	arena_block *block = m_arena;
+	if (block == NULL || block->m_top + size > block->m_end)
+	{
+		// big allocations get a block to themselves so the current one keeps filling
+		size_t blocksize = MAX(size, ARENA_BLOCK_SIZE);
+		UINT8 *raw = reinterpret_cast<UINT8 *>(malloc_file_line(header + blocksize, __FILE__, __LINE__, false, true, false));
+		block = reinterpret_cast<arena_block *>(raw);
+		block->m_base = block->m_top = raw + header;
+		block->m_end = block->m_base + blocksize;
+		if (m_arena != NULL && size > ARENA_BLOCK_SIZE / 4)
+		{
+			block->m_next = m_arena->m_next;
+			m_arena->m_next = block;
+		}
+		else
+		{
+			block->m_next = m_arena;
+			m_arena = block;
+		}
+	}
+
+	void *result = block->m_top;
+	block->m_top += size;
+
+	osd_lock_release(m_listlock);
+	return result;
+}
+
+
+//-------------------------------------------------
+//  arena_claim - if the pointer is a tagged
+//  arena allocation, drop the tag and return true
+//-------------------------------------------------
+
+bool resource_pool::arena_claim(void *ptr)
+{
+	bool result = false;
+
+	osd_lock_acquire(m_listlock);
+
+	// the most recent allocation is almost always the one being claimed
+	for (int index = m_arena_pending.count() - 1; index >= 0; index--)
+		if (m_arena_pending[index] == ptr)
+		{
+			for ( ; index < m_arena_pending.count() - 1; index++)
+				m_arena_pending[index] = m_arena_pending[index + 1];
+			m_arena_pending.resize_keep(m_arena_pending.count() - 1);
+			result = true;
+			break;
+		}
+
 	osd_lock_release(m_listlock);
+	return result;
+}
+
+
+//-------------------------------------------------
+//  arena_free_all - release all arena blocks
+//-------------------------------------------------
+
+void resource_pool::arena_free_all()
+{
+	while (m_arena != NULL)
+	{
+		arena_block *block = m_arena;
+		m_arena = block->m_next;
+		free_file_line(block, __FILE__, __LINE__, false);
+	}
+	m_arena_pending.reset();
+}
+
+
+//-------------------------------------------------
+//  rehash - resize the hash table, relinking all
+//  existing items
+//-------------------------------------------------
+
+void resource_pool::rehash(int newsize)
+{
+	m_hash.resize_and_clear(newsize, 0);
+	m_hash_size = newsize;
+	for (resource_pool_item *item = m_ordered_head; item != NULL; item = item->m_ordered_next)
+	{
+		int hashval = reinterpret_cast<FPTR>(item->m_ptr) % m_hash_size;
+		item->m_next = m_hash[hashval];
+		m_hash[hashval] = item;
+	}
 }
@@ -39,8 +39,8 @@
 #endif
 
 // pool allocation helpers
-#define pool_alloc(_pool, _type)                    (_pool).add_object(new(__FILE__, __LINE__) _type)
-#define pool_alloc_clear(_pool, _type)              (_pool).add_object(new(__FILE__, __LINE__, zeromem) _type)
+#define pool_alloc(_pool, _type)                    (_pool).add_object(new(_pool, __FILE__, __LINE__) _type)
+#define pool_alloc_clear(_pool, _type)              (_pool).add_object(new(_pool, __FILE__, __LINE__, zeromem) _type)
 #define pool_alloc_array(_pool, _type, _num)        (_pool).add_array(new(__FILE__, __LINE__) _type[_num], (_num))
 #define pool_alloc_array_clear(_pool, _type, _num)  (_pool).add_array(new(__FILE__, __LINE__, zeromem) _type[_num], (_num))
 #define pool_free(_pool, v)                         (_pool).remove(v)
@@ -65,7 +65,8 @@ public:
 			m_ordered_prev(NULL),
 			m_ptr(ptr),
 			m_size(size),
-			m_id(~(UINT64)0) { }
+			m_id(~(UINT64)0),
+			m_arena(false) { }
 	virtual ~resource_pool_item() { }
 
 	resource_pool_item *    m_next;
@@ -74,6 +75,7 @@ public:
 	void *                  m_ptr;
 	size_t                  m_size;
 	UINT64                  m_id;
+	bool                    m_arena;        // item and object live in the pool's arena
 };
 
 
@@ -96,6 +98,26 @@ private:
 };
 
 
+// a resource_pool_arena_object wraps an object carved out of the pool's
+// arena; only its destructor is run, the memory goes away with the arena
+template<class _ObjectClass>
+class resource_pool_arena_object : public resource_pool_item
+{
+private:
+	resource_pool_arena_object<_ObjectClass>(const resource_pool_arena_object<_ObjectClass> &);
+	resource_pool_arena_object<_ObjectClass> &operator=(const resource_pool_arena_object<_ObjectClass> &);
+
+public:
+	resource_pool_arena_object(_ObjectClass *object)
+		: resource_pool_item(reinterpret_cast<void *>(object), sizeof(_ObjectClass)),
+			m_object(object) { m_arena = true; }
+	virtual ~resource_pool_arena_object() { m_object->~_ObjectClass(); }
+
+private:
+	_ObjectClass *          m_object;
+};
+
+
 // a resource_pool_array is a simple object wrapper for an allocated array of
 // the templatized type
 template<class _ObjectClass> class resource_pool_array : public resource_pool_item
@@ -136,17 +158,62 @@ public:
 	bool contains(void *ptrstart, void *ptrend);
 	void clear();
 
-	template<class _ObjectClass> _ObjectClass *add_object(_ObjectClass* object) { add(*EMUALLOC_SELF_NEW resource_pool_object<_ObjectClass>(object), sizeof(_ObjectClass), typeid(_ObjectClass).name()); return object; }
+	// arena mode: pool_alloc'ed objects are bump-allocated and freed in bulk
+	void set_arena(bool enable) { m_arena_enabled = enable; }
+	bool arena_enabled() const { return m_arena_enabled; }
+	void *alloc_memory(size_t size, const char *file, int line, bool clear);
+	void free_memory(void *ptr, const char *file, int line);
+
+	template<class _ObjectClass> _ObjectClass *add_object(_ObjectClass* object)
+	{
+		// alloc_memory tags every arena allocation, so only tagged pointers need checking
+		if (m_arena_pending.count() > 0 && arena_claim(object))
+			add(*new(arena_alloc(sizeof(resource_pool_arena_object<_ObjectClass>))) resource_pool_arena_object<_ObjectClass>(object), sizeof(_ObjectClass), typeid(_ObjectClass).name());
+		else
+			add(*EMUALLOC_SELF_NEW resource_pool_object<_ObjectClass>(object), sizeof(_ObjectClass), typeid(_ObjectClass).name());
+		return object;
+	}
 	template<class _ObjectClass> _ObjectClass *add_array(_ObjectClass* array, int count) { add(*EMUALLOC_SELF_NEW resource_pool_array<_ObjectClass>(array, count), sizeof(_ObjectClass), typeid(_ObjectClass).name()); return array; }
 
 private:
+	// arena blocks are chained with the block currently being filled first
+	struct arena_block
+	{
+		arena_block *       m_next;
+		UINT8 *             m_base;
+		UINT8 *             m_top;
+		UINT8 *             m_end;
+	};
+
+	void *arena_alloc(size_t size);
+	bool arena_claim(void *ptr);
+	void arena_free_all();
+	void rehash(int newsize);
+
 	int                     m_hash_size;
+	int                     m_count;
 	osd_lock *              m_listlock;
 	dynamic_array<resource_pool_item *> m_hash;
 	resource_pool_item *    m_ordered_head;
 	resource_pool_item *    m_ordered_tail;
+	bool                    m_arena_enabled;
+	arena_block *           m_arena;
+	dynamic_array<void *>   m_arena_pending;    // arena allocations not yet claimed by add_object
 	static UINT64			s_id;
 };
 
 
+
+//**************************************************************************
+//  INLINE FUNCTIONS
+//**************************************************************************
+
+// operator new for pool allocations; pool_alloc uses these so that objects can
+// come from the pool's arena without the macros changing shape
+ATTR_FORCE_INLINE inline void *operator new(std::size_t size, resource_pool &pool, const char *file, int line) throw (std::bad_alloc) { return pool.alloc_memory(size, file, line, false); }
+ATTR_FORCE_INLINE inline void *operator new(std::size_t size, resource_pool &pool, const char *file, int line, const zeromem_t &) throw (std::bad_alloc) { return pool.alloc_memory(size, file, line, true); }
+ATTR_FORCE_INLINE inline void operator delete(void *ptr, resource_pool &pool, const char *file, int line) { pool.free_memory(ptr, file, line); }
+ATTR_FORCE_INLINE inline void operator delete(void *ptr, resource_pool &pool, const char *file, int line, const zeromem_t &) { pool.free_memory(ptr, file, line); }
+
+
 #endif  /* __EMUALLOC_H__ */
@@ -71,6 +71,9 @@ enum
 #define OPTION_STATE                "state"
 #define OPTION_AUTOSAVE             "autosave"
 #define OPTION_PLAYBACK             "playback"
+#define OPTION_PLAYBACK_LIST        "playback_list"
+#define OPTION_FRAME_HASH           "framehash"
+#define OPTION_FRAME_HASH_STATE     "framehash_state"
 #define OPTION_RECORD               "record"
 #define OPTION_MNGWRITE             "mngwrite"
 #define OPTION_AVIWRITE             "aviwrite"
@@ -85,10 +88,13 @@ enum
 #define OPTION_AUTOFRAMESKIP        "autoframeskip"
 #define OPTION_FRAMESKIP            "frameskip"
 #define OPTION_SECONDS_TO_RUN       "seconds_to_run"
+#define OPTION_BENCH_RESULTS        "bench_results"
 #define OPTION_THROTTLE             "throttle"
 #define OPTION_SLEEP                "sleep"
 #define OPTION_SPEED                "speed"
 #define OPTION_REFRESHSPEED         "refreshspeed"
+#define OPTION_IDLE_DETECT          "idle_detect"
+#define OPTION_ROM_CACHE            "romcache"
 
 // core rotation options
 #define OPTION_ROTATE               "rotate"
@@ -162,6 +168,7 @@ enum
 #define OPTION_DEBUG                "debug"
 #define OPTION_DEBUG_INTERNAL       "debug_internal"
 #define OPTION_DEBUGSCRIPT          "debugscript"
+#define OPTION_PROFILE_TRACE        "profile_trace"
 
 // core misc options
 #define OPTION_DRC                  "drc"
@@ -239,6 +246,9 @@ public:
 	const char *state() const { return value(OPTION_STATE); }
 	bool autosave() const { return bool_value(OPTION_AUTOSAVE); }
 	const char *playback() const { return value(OPTION_PLAYBACK); }
+	const char *playback_list() const { return value(OPTION_PLAYBACK_LIST); }
+	const char *frame_hash() const { return value(OPTION_FRAME_HASH); }
+	bool frame_hash_state() const { return bool_value(OPTION_FRAME_HASH_STATE); }
 	const char *record() const { return value(OPTION_RECORD); }
 	const char *mng_write() const { return value(OPTION_MNGWRITE); }
 	const char *avi_write() const { return value(OPTION_AVIWRITE); }
@@ -253,10 +263,13 @@ public:
 	bool auto_frameskip() const { return bool_value(OPTION_AUTOFRAMESKIP); }
 	int frameskip() const { return int_value(OPTION_FRAMESKIP); }
 	int seconds_to_run() const { return int_value(OPTION_SECONDS_TO_RUN); }
+	const char *bench_results() const { return value(OPTION_BENCH_RESULTS); }
 	bool throttle() const { return bool_value(OPTION_THROTTLE); }
 	bool sleep() const { return bool_value(OPTION_SLEEP); }
 	float speed() const { return float_value(OPTION_SPEED); }
 	bool refresh_speed() const { return bool_value(OPTION_REFRESHSPEED); }
+	const char *idle_detect() const { return value(OPTION_IDLE_DETECT); }
+	bool rom_cache() const { return bool_value(OPTION_ROM_CACHE); }
 
 	// core rotation options
 	bool rotate() const { return bool_value(OPTION_ROTATE); }
@@ -327,6 +340,7 @@ public:
 	bool debug() const { return bool_value(OPTION_DEBUG); }
 	bool debug_internal() const { return bool_value(OPTION_DEBUG_INTERNAL); }
 	const char *debug_script() const { return value(OPTION_DEBUGSCRIPT); }
+	const char *profile_trace() const { return value(OPTION_PROFILE_TRACE); }
 	bool update_in_pause() const { return bool_value(OPTION_UPDATEINPAUSE); }
 
 	// core misc options
@@ -212,12 +212,42 @@ void info_xml_creator::output(FILE *out)
 		CONFIG_VERSION
 	);
 
+	// devices are listed after all the drivers, but we gather them into a
+	// temporary file while each driver's configuration is at hand, so that
+	// every configuration only has to be constructed once
+	FILE *devices = tmpfile();
+	device_map shortnames;
+
 	// iterate through the drivers, outputting one at a time
 	while (m_drivlist.next())
+	{
 		output_one();
+		if (devices != NULL)
+		{
+			m_output = devices;
+			output_devices(shortnames);
+			m_output = out;
+		}
+	}
 
 	// output devices (both devices with roms and slot devices)
-	output_devices();
+	if (devices != NULL)
+	{
+		char buffer[4096];
+		size_t bytes;
+		rewind(devices);
+		while ((bytes = fread(buffer, 1, sizeof(buffer), devices)) > 0)
+			fwrite(buffer, 1, bytes, m_output);
+		fclose(devices);
+	}
+
+	// no temporary file; make a second pass over all the drivers instead
+	else
+	{
+		m_drivlist.reset();
+		while (m_drivlist.next())
+			output_devices(shortnames);
+	}
 
 	// close the top level tag
 	fprintf(m_output, "</%s>\n",emulator_info::get_xml_root());
@@ -370,50 +400,43 @@ void info_xml_creator::output_one_device(device_t &device, const char *devtag)
 //-------------------------------------------------
 //  output_devices - print the XML info for devices
 //  with roms and for devices that can be mounted
-//  in slots
+//  in slots, for the current driver; shortnames
+//  tracks which devices have already been printed
 //-------------------------------------------------
 
-typedef tagmap_t<FPTR> slot_map;
-
-void info_xml_creator::output_devices()
+void info_xml_creator::output_devices(device_map &shortnames)
 {
-	m_drivlist.reset();
-	slot_map shortnames;
-
-	while (m_drivlist.next())
+	// first, run through devices with roms which belongs to the default configuration
+	device_iterator deviter(m_drivlist.config().root_device());
+	for (device_t *device = deviter.first(); device != NULL; device = deviter.next())
 	{
-		// first, run through devices with roms which belongs to the default configuration
-		device_iterator deviter(m_drivlist.config().root_device());
-		for (device_t *device = deviter.first(); device != NULL; device = deviter.next())
+		if (device->owner() != NULL && device->shortname()!= NULL && strlen(device->shortname())!=0)
 		{
-			if (device->owner() != NULL && device->shortname()!= NULL && strlen(device->shortname())!=0)
-			{
-				if (shortnames.add(device->shortname(), 0, FALSE) != TMERR_DUPLICATE)
-					output_one_device(*device, device->tag());
-			}
+			if (shortnames.add(device->shortname(), 0, FALSE) != TMERR_DUPLICATE)
+				output_one_device(*device, device->tag());
 		}
+	}
 
-		// then, run through slot devices
-		slot_interface_iterator iter(m_drivlist.config().root_device());
-		for (const device_slot_interface *slot = iter.first(); slot != NULL; slot = iter.next())
+	// then, run through slot devices
+	slot_interface_iterator iter(m_drivlist.config().root_device());
+	for (const device_slot_interface *slot = iter.first(); slot != NULL; slot = iter.next())
+	{
+		for (const device_slot_option *option = slot->first_option(); option != NULL; option = option->next())
 		{
-			for (const device_slot_option *option = slot->first_option(); option != NULL; option = option->next())
-			{
-				astring temptag("_");
-				temptag.cat(option->name());
-				device_t *dev = const_cast<machine_config &>(m_drivlist.config()).device_add(&m_drivlist.config().root_device(), temptag.cstr(), option->devtype(), 0);
+			astring temptag("_");
+			temptag.cat(option->name());
+			device_t *dev = const_cast<machine_config &>(m_drivlist.config()).device_add(&m_drivlist.config().root_device(), temptag.cstr(), option->devtype(), 0);
 
-				// notify this device and all its subdevices that they are now configured
-				device_iterator subiter(*dev);
-				for (device_t *device = subiter.first(); device != NULL; device = subiter.next())
-					if (!device->configured())
-						device->config_complete();
+			// notify this device and all its subdevices that they are now configured
+			device_iterator subiter(*dev);
+			for (device_t *device = subiter.first(); device != NULL; device = subiter.next())
+				if (!device->configured())
+					device->config_complete();
 
-				if (shortnames.add(dev->shortname(), 0, FALSE) != TMERR_DUPLICATE)
-					output_one_device(*dev, temptag.cstr());
+			if (shortnames.add(dev->shortname(), 0, FALSE) != TMERR_DUPLICATE)
+				output_one_device(*dev, temptag.cstr());
 
-				const_cast<machine_config &>(m_drivlist.config()).device_remove(&m_drivlist.config().root_device(), temptag.cstr());
-			}
+			const_cast<machine_config &>(m_drivlist.config()).device_remove(&m_drivlist.config().root_device(), temptag.cstr());
 		}
 	}
 }
@@ -31,6 +31,8 @@ public:
 	void output(FILE *out);
 
 private:
+	typedef tagmap_t<FPTR> device_map;
+
 	// internal helper
 	void output_one();
 	void output_sampleof();
@@ -52,7 +54,7 @@ private:
 	void output_ramoptions();
 
 	void output_one_device(device_t &device, const char *devtag);
-	void output_devices();
+	void output_devices(device_map &shortnames);
 
 	const char *get_merge_name(const hash_collection &romhashes);
 
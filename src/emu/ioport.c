@@ -3558,6 +3558,20 @@ void ioport_manager::playback_end(const char *message)
 		m_playback_accumulated_speed /= m_playback_accumulated_frames;
 		mame_printf_info("Total playback frames: %d\n", UINT32(m_playback_accumulated_frames));
 		mame_printf_info("Average recorded speed: %d%%\n", UINT32((m_playback_accumulated_speed * 200 + 1) >> 21));
+
+		// in batch playback, report where the recording left us and move on to the next;
+		// by the time exit() closes an unfinished recording the machine is being torn
+		// down, so there is no state left to hash
+		if (machine().options().playback_list()[0] != 0)
+		{
+			if (message != NULL)
+			{
+				mame_printf_info("Playback result: %s frames=%d state_crc=%08x\n", machine().options().playback(), UINT32(m_playback_accumulated_frames), machine().save().state_crc());
+				machine().schedule_hard_reset();
+			}
+			else
+				mame_printf_info("Playback result: %s frames=%d incomplete\n", machine().options().playback(), UINT32(m_playback_accumulated_frames));
+		}
 	}
 }
 
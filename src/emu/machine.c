@@ -345,12 +345,26 @@ int running_machine::run(bool firstrun)
 			add_logerror_callback(logfile_callback);
 		}
 
-		// then finish setting up our local machine
+		// then finish setting up our local machine; nearly everything allocated
+		// here lives as long as the machine, so let the pool bump-allocate it
+		m_respool.set_arena(true);
 		start();
+		m_respool.set_arena(false);
 
-		// load the configuration settings and NVRAM
-		bool settingsloaded = config_load_settings(*this);
-		nvram_load();
+		// load the configuration settings and NVRAM; batch playback starts every
+		// recording from defaults and leaves the user's files alone
+		bool batchplayback = (options().playback_list()[0] != 0);
+		bool settingsloaded = false;
+		if (batchplayback)
+		{
+			config_apply_defaults(*this);
+			nvram_reset();
+		}
+		else
+		{
+			settingsloaded = config_load_settings(*this);
+			nvram_load();
+		}
 		sound().ui_mute(false);
 
 		// initialize ui lists
@@ -359,8 +373,15 @@ int running_machine::run(bool firstrun)
 		// display the startup screens
 		ui().display_startup_screens(firstrun, !settingsloaded);
 
+		// start recording a profiler trace if requested
+		if (options().profile_trace()[0] != 0)
+			g_profiler.start_trace();
+
 		// perform a soft reset -- this takes us to the running phase
 		soft_reset();
+#ifdef MAME_DEBUG
+		INT32 startup_tagmap_finds = g_tagmap_finds;
+#endif
 
 		// run the CPUs until a reset or exit
 		m_hard_reset_pending = false;
@@ -390,11 +411,19 @@ int running_machine::run(bool firstrun)
 
 		// and out via the exit phase
 		m_current_phase = MACHINE_PHASE_EXIT;
+#ifdef MAME_DEBUG
+		// tag lookups while running usually mean a handler should cache a pointer
+		mame_printf_info("%d tagmap lookups during startup, %d while running\n", startup_tagmap_finds, g_tagmap_finds - startup_tagmap_finds);
+		g_tagmap_finds = 0;
+#endif
 
 		// save the NVRAM and configuration
 		sound().ui_mute(true);
-		nvram_save();
-		config_save_settings(*this);
+		if (!batchplayback)
+		{
+			nvram_save();
+			config_save_settings(*this);
+		}
 	}
 	catch (emu_fatalerror &fatal)
 	{
@@ -428,6 +457,10 @@ int running_machine::run(bool firstrun)
 	// in case we got here via exception
 	m_current_phase = MACHINE_PHASE_EXIT;
 
+	// write out the profiler trace, if any
+	if (g_profiler.tracing())
+		g_profiler.stop_trace(*this, options().profile_trace());
+
 	// call all exit callbacks registered
 	call_notifiers(MACHINE_NOTIFY_EXIT);
 	zip_file_cache_clear();
@@ -1253,6 +1286,22 @@ void running_machine::nvram_load()
 }
 
 
+/*-------------------------------------------------
+    nvram_reset - put a system's NVRAM in its
+    default state without touching any files
+-------------------------------------------------*/
+
+void running_machine::nvram_reset()
+{
+	if (config().m_nvram_handler != NULL)
+		(*config().m_nvram_handler)(*this, NULL, FALSE);
+
+	nvram_interface_iterator iter(root_device());
+	for (device_nvram_interface *nvram = iter.first(); nvram != NULL; nvram = iter.next())
+		nvram->nvram_reset();
+}
+
+
 /*-------------------------------------------------
     nvram_save - save a system's NVRAM
 -------------------------------------------------*/
@@ -74,6 +74,7 @@ const int DEBUG_FLAG_WPW_PROGRAM    = 0x00000100;       // watchpoints are enabl
 const int DEBUG_FLAG_WPW_DATA       = 0x00000200;       // watchpoints are enabled for DATA memory writes
 const int DEBUG_FLAG_WPW_IO         = 0x00000400;       // watchpoints are enabled for IO memory writes
 const int DEBUG_FLAG_OSD_ENABLED    = 0x00001000;       // The OSD debugger is enabled
+const int DEBUG_FLAG_IDLE_DETECT    = 0x00002000;       // CPU cores must call the idle loop detector
 
 
 
@@ -290,6 +291,7 @@ private:
 	const char *image_parent_basename(device_t *device);
 	astring &nvram_filename(astring &result, device_t &device);	
 	void nvram_load();
+	void nvram_reset();
 	void nvram_save();
 
 	// internal callbacks
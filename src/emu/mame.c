@@ -131,6 +131,30 @@ int mame_is_valid_machine(running_machine &machine)
 	return (&machine == global_machine);
 }
 
+/*-------------------------------------------------
+    playback_list_next - point the playback option
+    at the next file named in a playback list;
+    returns false once the list is exhausted
+-------------------------------------------------*/
+
+static bool playback_list_next(emu_options &options, emu_file &list)
+{
+	char buffer[1024];
+	while (list.gets(buffer, ARRAY_LENGTH(buffer)) != NULL)
+	{
+		astring filename(buffer);
+		filename.trimspace();
+		if (filename.len() == 0 || filename[0] == '#')
+			continue;
+
+		astring error;
+		options.set_value(OPTION_PLAYBACK, filename.cstr(), OPTION_PRIORITY_CMDLINE, error);
+		return true;
+	}
+	return false;
+}
+
+
 /*-------------------------------------------------
     mame_execute - run the core emulation
 -------------------------------------------------*/
@@ -139,6 +163,7 @@ int mame_execute(emu_options &options, osd_interface &osd)
 {
 	bool firstgame = true;
 	bool firstrun = true;
+	const game_driver *validated = NULL;
 
 	// extract the verbose printing option
 	if (options.verbose())
@@ -150,8 +175,20 @@ int mame_execute(emu_options &options, osd_interface &osd)
 
 	web_engine web(options);
 
+	// open the list of recordings for batch playback
+	emu_file playlist(options.input_directory(), OPEN_FLAG_READ);
+	if (options.playback_list()[0] != 0 && playlist.open(options.playback_list()) != FILERR_NONE)
+	{
+		mame_printf_error("Unable to open playback list %s\n", options.playback_list());
+		return MAMERR_FATALERROR;
+	}
+
 	while (error == MAMERR_NONE && !exit_pending)
 	{
+		// in batch playback, every run replays the next recording
+		if (playlist.is_open() && !playback_list_next(options, playlist))
+			break;
+
 		// if no driver, use the internal empty driver
 		const game_driver *system = options.system();
 		if (system == NULL)
@@ -171,11 +208,13 @@ int mame_execute(emu_options &options, osd_interface &osd)
 			options.parse_standard_inis(errors);
 		}
 		
-		// otherwise, perform validity checks before anything else
-		if (system != NULL)
+		// otherwise, perform validity checks before anything else; a hard reset
+		// of the same system has already been through them
+		if (system != NULL && system != validated)
 		{
 			validity_checker valid(options);
 			valid.check_shared_source(*system);
+			validated = system;
 		}
 
 		// create the machine configuration
@@ -206,6 +245,10 @@ int mame_execute(emu_options &options, osd_interface &osd)
 		// machine will go away when we exit scope
 		global_machine = NULL;
 	}
+
+	// drop any ROM regions kept across hard resets
+	rom_cache_flush();
+
 	// return an error
 	return error;
 }
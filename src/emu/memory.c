@@ -596,7 +596,7 @@ public:
 
 	// getters
 	virtual handler_entry &handler(UINT32 index) const = 0;
-	bool watchpoints_enabled() const { return (m_live_lookup == s_watchpoint_table); }
+	bool watchpoints_enabled() const { return (m_watch_mode != WATCH_NONE); }
 
 	// address lookups
 	UINT32 lookup_live(offs_t byteaddress) const { return m_large ? lookup_live_large(byteaddress) : lookup_live_small(byteaddress); }
@@ -606,7 +606,7 @@ public:
 	{
 		UINT32 entry = m_live_lookup[level1_index_large(byteaddress)];
 		if (entry >= SUBTABLE_BASE)
-			entry = m_live_lookup[level2_index_large(entry, byteaddress)];
+			entry = static_cast<const UINT16 *>(m_table)[level2_index_large(entry, byteaddress)];
 		return entry;
 	}
 
@@ -614,12 +614,13 @@ public:
 	{
 		UINT32 entry = m_live_lookup[level1_index(byteaddress)];
 		if (entry >= SUBTABLE_BASE)
-			entry = m_live_lookup[level2_index(entry, byteaddress)];
+			entry = static_cast<const UINT16 *>(m_table)[level2_index(entry, byteaddress)];
 		return entry;
 	}
 
 	// enable watchpoints by swapping in the watchpoint table
-	void enable_watchpoints(bool enable = true) { m_live_lookup = enable ? s_watchpoint_table : &m_table[0]; }
+	void enable_watchpoints(bool enable = true) { m_watch_mode = enable ? WATCH_ALL : WATCH_NONE; m_watch_ranges.reset(); update_live_lookup(); }
+	void enable_watchpoints(offs_t bytestart, offs_t byteend);
 
 	// table mapping helpers
 	void map_range(offs_t bytestart, offs_t byteend, offs_t bytemask, offs_t bytemirror, UINT16 staticentry);
@@ -650,6 +651,27 @@ protected:
 	void subtable_close(offs_t l1index);
 	UINT16 *subtable_ptr(UINT16 entry) { return &m_table[level2_index(entry, 0)]; }
 
+	// level 1 updates go through here so a partial watchpoint table stays in sync
+	void set_level1(offs_t l1index, UINT16 entry)
+	{
+		m_table[l1index] = entry;
+		if (m_watch_mode == WATCH_PARTIAL)
+			m_watch_table[l1index] = m_watch_pages[l1index] ? UINT16(STATIC_WATCHPOINT) : entry;
+	}
+
+	// partial watchpoint table management
+	void watch_table_rebuild();
+
+	// point lookups at the table matching the watchpoint mode; while a
+	// watchpoint handler is forwarding an access, that is the real table
+	void update_live_lookup()
+	{
+		if (m_watch_suspended != 0 || m_watch_mode == WATCH_NONE)
+			m_live_lookup = m_table;
+		else
+			m_live_lookup = (m_watch_mode == WATCH_ALL) ? s_watchpoint_table : &m_watch_table[0];
+	}
+
 	// internal state
 	dynamic_array<UINT16>   m_table;                    // pointer to base of table
 	UINT16 *                m_live_lookup;              // current lookup
@@ -672,6 +694,20 @@ protected:
 	dynamic_array<subtable_data> m_subtable;            // info about each subtable
 	UINT16                  m_subtable_alloc;           // number of subtables allocated
 
+	// per-page watchpoint table: a copy of the level 1 part of m_table with the
+	// watched pages redirected; level 2 lookups always go to m_table
+	enum watch_mode
+	{
+		WATCH_NONE,
+		WATCH_ALL,
+		WATCH_PARTIAL
+	};
+	watch_mode              m_watch_mode;               // which pages are being watched
+	int                     m_watch_suspended;          // depth of watchpoint handlers forwarding an access
+	dynamic_array<UINT16>   m_watch_table;              // level 1 lookup used while only some pages are watched
+	dynamic_array<UINT8>    m_watch_pages;              // nonzero for each watched level 1 entry
+	dynamic_array<offs_t>   m_watch_ranges;             // start/end byte address pairs being watched
+
 	// static global read-only watchpoint table
 	static UINT16           s_watchpoint_table[1 << LEVEL1_BITS];
 
@@ -760,14 +796,15 @@ private:
 	{
 		m_space.device().debug()->memory_read_hook(m_space, offset * sizeof(_UintType), mask);
 
-		UINT16 *oldtable = m_live_lookup;
-		m_live_lookup = m_table;
+		m_watch_suspended++;
+		update_live_lookup();
 		_UintType result;
 		if (sizeof(_UintType) == 1) result = m_space.read_byte(offset);
 		if (sizeof(_UintType) == 2) result = m_space.read_word(offset << 1, mask);
 		if (sizeof(_UintType) == 4) result = m_space.read_dword(offset << 2, mask);
 		if (sizeof(_UintType) == 8) result = m_space.read_qword(offset << 3, mask);
-		m_live_lookup = oldtable;
+		m_watch_suspended--;
+		update_live_lookup();
 		return result;
 	}
 
@@ -828,13 +865,14 @@ private:
 	{
 		m_space.device().debug()->memory_write_hook(m_space, offset * sizeof(_UintType), data, mask);
 
-		UINT16 *oldtable = m_live_lookup;
-		m_live_lookup = m_table;
+		m_watch_suspended++;
+		update_live_lookup();
 		if (sizeof(_UintType) == 1) m_space.write_byte(offset, data);
 		if (sizeof(_UintType) == 2) m_space.write_word(offset << 1, data, mask);
 		if (sizeof(_UintType) == 4) m_space.write_dword(offset << 2, data, mask);
 		if (sizeof(_UintType) == 8) m_space.write_qword(offset << 3, data, mask);
-		m_live_lookup = oldtable;
+		m_watch_suspended--;
+		update_live_lookup();
 	}
 
 	// internal state
@@ -1063,6 +1101,8 @@ public:
 	// watchpoint control
 	virtual void enable_read_watchpoints(bool enable = true) { m_read.enable_watchpoints(enable); }
 	virtual void enable_write_watchpoints(bool enable = true) { m_write.enable_watchpoints(enable); }
+	virtual void enable_read_watchpoints(offs_t bytestart, offs_t byteend) { m_read.enable_watchpoints(bytestart, byteend); }
+	virtual void enable_write_watchpoints(offs_t bytestart, offs_t byteend) { m_write.enable_watchpoints(bytestart, byteend); }
 
 	// generate accessor table
 	virtual void accessors(data_accessors &accessors) const
@@ -2897,7 +2937,9 @@ address_table::address_table(address_space &space, bool large)
 		m_space(space),
 		m_large(large),
 		m_subtable(SUBTABLE_COUNT),
-		m_subtable_alloc(0)
+		m_subtable_alloc(0),
+		m_watch_mode(WATCH_NONE),
+		m_watch_suspended(0)
 {
 	// make our static table all watchpoints
 	if (s_watchpoint_table[0] != STATIC_WATCHPOINT)
@@ -3258,7 +3300,7 @@ void address_table::populate_range(offs_t bytestart, offs_t byteend, UINT16 hand
 			subtable_release(subindex);
 		else
 			handler_unref(subindex);
-		m_table[l1index] = handlerindex;
+		set_level1(l1index, handlerindex);
 	}
 }
 
@@ -3329,7 +3371,7 @@ void address_table::populate_range_mirrored(offs_t bytestart, offs_t byteend, of
 					handler_ref(m_table[prev_index], 1);
 
 				// set the new value and short-circuit the mapping step
-				m_table[cur_index] = m_table[prev_index];
+				set_level1(cur_index, m_table[prev_index]);
 				continue;
 			}
 			prev_index = cur_index;
@@ -3468,6 +3510,63 @@ void address_table::mask_all_handlers(offs_t mask)
 //  SUBTABLE MANAGEMENT
 //**************************************************************************
 
+//-------------------------------------------------
+//  enable_watchpoints - route accesses to the
+//  pages overlapping the given byte range through
+//  the watchpoint handler, leaving the rest of
+//  the space on the fast path
+//-------------------------------------------------
+
+void address_table::enable_watchpoints(offs_t bytestart, offs_t byteend)
+{
+	// nothing to do if the whole space is already being watched
+	if (m_watch_mode == WATCH_ALL)
+		return;
+
+	// clamp to the space and widen to whole bus accesses
+	offs_t bytemask = m_space.bytemask();
+	bytestart &= bytemask;
+	if (byteend > bytemask || byteend < bytestart)
+		byteend = bytemask;
+	bytestart &= ~(m_space.data_width() / 8 - 1);
+
+	// a fresh table starts from the unwatched state
+	if (m_watch_mode != WATCH_PARTIAL)
+		m_watch_ranges.reset();
+	m_watch_ranges.append(bytestart);
+	m_watch_ranges.append(byteend);
+	m_watch_mode = WATCH_PARTIAL;
+	watch_table_rebuild();
+	update_live_lookup();
+}
+
+
+//-------------------------------------------------
+//  watch_table_rebuild - regenerate the partial
+//  watchpoint table from the level 1 table and
+//  the list of watched ranges; later mapping
+//  changes are mirrored by set_level1
+//-------------------------------------------------
+
+void address_table::watch_table_rebuild()
+{
+	// mark every level 1 entry that overlaps a watched range
+	m_watch_pages.resize_and_clear(1 << LEVEL1_BITS, 0);
+	for (int rangenum = 0; rangenum < m_watch_ranges.count(); rangenum += 2)
+	{
+		UINT32 l1start = level1_index(m_watch_ranges[rangenum]);
+		UINT32 l1end = level1_index(m_watch_ranges[rangenum + 1]);
+		for (UINT32 l1index = l1start; l1index <= l1end; l1index++)
+			m_watch_pages[l1index] = 1;
+	}
+
+	// the watched entries route to the watchpoint handler, the rest match m_table
+	m_watch_table.resize(1 << LEVEL1_BITS);
+	for (UINT32 l1index = 0; l1index < (1 << LEVEL1_BITS); l1index++)
+		m_watch_table[l1index] = m_watch_pages[l1index] ? UINT16(STATIC_WATCHPOINT) : m_table[l1index];
+}
+
+
 //-------------------------------------------------
 //  subtable_alloc - allocate a fresh subtable
 //  and set its usecount to 1
@@ -3488,10 +3587,8 @@ UINT16 address_table::subtable_alloc()
 					m_subtable_alloc += SUBTABLE_ALLOC;
 					UINT32 newsize = (1 << LEVEL1_BITS) + (m_subtable_alloc << level2_bits());
 
-					bool was_live = (m_live_lookup == m_table);
 					m_table.resize_keep_and_clear_new(newsize);
-					if (was_live)
-						m_live_lookup = m_table;
+					update_live_lookup();
 				}
 				// bump the usecount and return
 				m_subtable[subindex].m_usecount++;
@@ -3572,7 +3669,7 @@ int address_table::subtable_merge()
 						{
 							subtable_release(sumindex + SUBTABLE_BASE);
 							subtable_realloc(subindex + SUBTABLE_BASE);
-							m_table[l1index] = subindex + SUBTABLE_BASE;
+							set_level1(l1index, subindex + SUBTABLE_BASE);
 							merged++;
 						}
 				}
@@ -3625,7 +3722,7 @@ UINT16 *address_table::subtable_open(offs_t l1index)
 		UINT16 *subptr = subtable_ptr(newentry);
 		for (int i=0; i<size; i++)
 			subptr[i] = subentry;
-		m_table[l1index] = newentry;
+		set_level1(l1index, newentry);
 		m_subtable[newentry - SUBTABLE_BASE].m_checksum = (subentry + (subentry << 8) + (subentry << 16) + (subentry << 24)) * ((1 << level2_bits())/4);
 		subentry = newentry;
 	}
@@ -3648,7 +3745,7 @@ UINT16 *address_table::subtable_open(offs_t l1index)
 
 		memcpy(subtable_ptr(newentry), src, 2*size);
 		subtable_release(subentry);
-		m_table[l1index] = newentry;
+		set_level1(l1index, newentry);
 		m_subtable[newentry - SUBTABLE_BASE].m_checksum = m_subtable[subentry - SUBTABLE_BASE].m_checksum;
 		subentry = newentry;
 	}
@@ -328,6 +328,8 @@ public:
 	// watchpoint enablers
 	virtual void enable_read_watchpoints(bool enable = true) = 0;
 	virtual void enable_write_watchpoints(bool enable = true) = 0;
+	virtual void enable_read_watchpoints(offs_t bytestart, offs_t byteend) = 0;
+	virtual void enable_write_watchpoints(offs_t bytestart, offs_t byteend) = 0;
 
 	// general accessors
 	virtual void accessors(data_accessors &accessors) const = 0;
@@ -51,6 +51,58 @@ profiler_state g_profiler;
 //**************************************************************************
 
 #define TEXT_UPDATE_TIME        0.5
+#define TRACE_MAX_EVENTS        (1 << 22)
+
+static const profile_string names[] =
+{
+	{ PROFILER_DRC_COMPILE,      "DRC Compilation" },
+	{ PROFILER_MEM_REMAP,        "Memory Remapping" },
+	{ PROFILER_MEMREAD,          "Memory Read" },
+	{ PROFILER_MEMWRITE,         "Memory Write" },
+	{ PROFILER_VIDEO,            "Video Update" },
+	{ PROFILER_DRAWGFX,          "drawgfx" },
+	{ PROFILER_COPYBITMAP,       "copybitmap" },
+	{ PROFILER_TILEMAP_DRAW,     "Tilemap Draw" },
+	{ PROFILER_TILEMAP_DRAW_ROZ, "Tilemap ROZ Draw" },
+	{ PROFILER_TILEMAP_UPDATE,   "Tilemap Update" },
+	{ PROFILER_BLIT,             "OSD Blitting" },
+	{ PROFILER_SOUND,            "Sound Generation" },
+	{ PROFILER_TIMER_CALLBACK,   "Timer Callbacks" },
+	{ PROFILER_INPUT,            "Input Processing" },
+	{ PROFILER_MOVIE_REC,        "Movie Recording" },
+	{ PROFILER_LOGERROR,         "Error Logging" },
+	{ PROFILER_WORK_ITEM,        "Work Items" },
+	{ PROFILER_EXTRA,            "Unaccounted/Overhead" },
+	{ PROFILER_USER1,            "User 1" },
+	{ PROFILER_USER2,            "User 2" },
+	{ PROFILER_USER3,            "User 3" },
+	{ PROFILER_USER4,            "User 4" },
+	{ PROFILER_USER5,            "User 5" },
+	{ PROFILER_USER6,            "User 6" },
+	{ PROFILER_USER7,            "User 7" },
+	{ PROFILER_USER8,            "User 8" },
+	{ PROFILER_PROFILER,         "Profiler" },
+	{ PROFILER_IDLE,             "Idle" }
+};
+
+
+
+//**************************************************************************
+//  INLINE FUNCTIONS
+//**************************************************************************
+
+//-------------------------------------------------
+//  type_name - return the display name of a
+//  non-device profile type
+//-------------------------------------------------
+
+static inline const char *type_name(int type)
+{
+	for (int nameindex = 0; nameindex < ARRAY_LENGTH(names); nameindex++)
+		if (names[nameindex].type == type)
+			return names[nameindex].string;
+	return "";
+}
 
 
 
@@ -80,6 +132,13 @@ real_profiler_state::real_profiler_state()
 {
 	memset(m_filo, 0, sizeof(m_filo));
 	memset(m_data, 0, sizeof(m_data));
+	m_trace_active = 0;
+	m_trace_writers = 0;
+	m_trace_threads = 0;
+	m_trace_next = 0;
+	m_trace_dropped = 0;
+	m_trace_osd_start = 0;
+	m_trace_profile_start = 0;
 	reset(false);
 }
 
@@ -141,37 +200,6 @@ const char *real_profiler_state::text(running_machine &machine)
 
 void real_profiler_state::update_text(running_machine &machine)
 {
-	static const profile_string names[] =
-	{
-		{ PROFILER_DRC_COMPILE,      "DRC Compilation" },
-		{ PROFILER_MEM_REMAP,        "Memory Remapping" },
-		{ PROFILER_MEMREAD,          "Memory Read" },
-		{ PROFILER_MEMWRITE,         "Memory Write" },
-		{ PROFILER_VIDEO,            "Video Update" },
-		{ PROFILER_DRAWGFX,          "drawgfx" },
-		{ PROFILER_COPYBITMAP,       "copybitmap" },
-		{ PROFILER_TILEMAP_DRAW,     "Tilemap Draw" },
-		{ PROFILER_TILEMAP_DRAW_ROZ, "Tilemap ROZ Draw" },
-		{ PROFILER_TILEMAP_UPDATE,   "Tilemap Update" },
-		{ PROFILER_BLIT,             "OSD Blitting" },
-		{ PROFILER_SOUND,            "Sound Generation" },
-		{ PROFILER_TIMER_CALLBACK,   "Timer Callbacks" },
-		{ PROFILER_INPUT,            "Input Processing" },
-		{ PROFILER_MOVIE_REC,        "Movie Recording" },
-		{ PROFILER_LOGERROR,         "Error Logging" },
-		{ PROFILER_EXTRA,            "Unaccounted/Overhead" },
-		{ PROFILER_USER1,            "User 1" },
-		{ PROFILER_USER2,            "User 2" },
-		{ PROFILER_USER3,            "User 3" },
-		{ PROFILER_USER4,            "User 4" },
-		{ PROFILER_USER5,            "User 5" },
-		{ PROFILER_USER6,            "User 6" },
-		{ PROFILER_USER7,            "User 7" },
-		{ PROFILER_USER8,            "User 8" },
-		{ PROFILER_PROFILER,         "Profiler" },
-		{ PROFILER_IDLE,             "Idle" }
-	};
-
 	// compute the total time for all bits, not including profiler or idle
 	UINT64 computed = 0;
 	profile_type curtype;
@@ -212,12 +240,7 @@ void real_profiler_state::update_text(running_machine &machine)
 			if (curtype >= PROFILER_DEVICE_FIRST && curtype <= PROFILER_DEVICE_MAX)
 				m_text.catprintf("'%s'", iter.byindex(curtype - PROFILER_DEVICE_FIRST)->tag());
 			else
-				for (int nameindex = 0; nameindex < ARRAY_LENGTH(names); nameindex++)
-					if (names[nameindex].type == curtype)
-					{
-						m_text.cat(names[nameindex].string);
-						break;
-					}
+				m_text.cat(type_name(curtype));
 
 			// followed by a carriage return
 			m_text.cat("\n");
@@ -227,3 +250,85 @@ void real_profiler_state::update_text(running_machine &machine)
 	// reset data set to 0
 	memset(m_data, 0, sizeof(m_data));
 }
+
+
+
+//-------------------------------------------------
+//  start_trace - begin recording trace events
+//-------------------------------------------------
+
+void real_profiler_state::start_trace()
+{
+	// allocate the buffer and note the time base
+	m_trace.resize(TRACE_MAX_EVENTS);
+	m_trace_next = 0;
+	m_trace_dropped = 0;
+	m_trace_osd_start = osd_ticks();
+	m_trace_profile_start = get_profile_ticks();
+	atomic_exchange32(&m_trace_active, 1);
+
+	// tracing needs the FILO running
+	enable(true);
+}
+
+
+//-------------------------------------------------
+//  stop_trace - stop recording trace events and
+//  write them out as Chrome trace event JSON
+//-------------------------------------------------
+
+void real_profiler_state::stop_trace(running_machine &machine, const char *filename)
+{
+	if (!tracing())
+		return;
+
+	// turn tracing off, then let any work items already recording an event
+	// finish with the buffer before we read or free it
+	atomic_exchange32(&m_trace_active, 0);
+	while (m_trace_writers != 0)
+		osd_sleep(0);
+
+	// determine how many events we got
+	int count = MIN(m_trace_next, m_trace.count());
+
+	// profile ticks may not run at the OSD tick rate, so calibrate against it
+	double osd_elapsed = (double)(osd_ticks() - m_trace_osd_start) / (double)osd_ticks_per_second();
+	double profile_elapsed = (double)(get_profile_ticks() - m_trace_profile_start);
+	double micros_per_tick = (profile_elapsed > 0) ? osd_elapsed * 1000000.0 / profile_elapsed : 0;
+
+	emu_file file(OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	file_error filerr = file.open(filename);
+	if (filerr == FILERR_NONE)
+	{
+		device_iterator iter(machine.root_device());
+		file.printf("{\"traceEvents\":[\n");
+		for (int index = 0; index < count; index++)
+		{
+			const trace_entry &entry = m_trace[index];
+
+			// name devices by tag and everything else by type
+			const char *name = "";
+			if (entry.type <= PROFILER_DEVICE_MAX)
+			{
+				device_t *device = iter.byindex(entry.type - PROFILER_DEVICE_FIRST);
+				if (device != NULL)
+					name = device->tag();
+			}
+			else
+				name = type_name(entry.type);
+
+			double timestamp = (double)(INT64)(entry.ticks - m_trace_profile_start) * micros_per_tick;
+			file.printf("{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":0,\"tid\":%d}%s\n",
+					name, entry.phase, timestamp, entry.thread, (index == count - 1) ? "" : ",");
+		}
+		file.printf("],\"displayTimeUnit\":\"ms\"}\n");
+	}
+	else
+		mame_printf_error("Unable to open trace file '%s'\n", filename);
+
+	if (m_trace_dropped > 0)
+		mame_printf_warning("Profiler trace buffer overflowed; %u events were dropped\n", m_trace_dropped);
+
+	// nobody can touch the buffer any more, so release it
+	m_trace.reset();
+}
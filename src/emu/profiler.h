@@ -19,6 +19,13 @@
 
     the profiler handles a FILO list so calls may be nested.
 
+    When tracing is active, each start/stop additionally records a
+    timestamped begin/end event, and work queue callbacks can record
+    their own events via thread_start/thread_stop, offsetting their
+    thread index by a per-queue thread_base(). The result is
+    written as a Chrome trace event JSON file that can be loaded into
+    chrome://tracing or Perfetto.
+
 ***************************************************************************/
 
 #pragma once
@@ -54,6 +61,7 @@ enum profile_type
 	PROFILER_INPUT,             // input.c and inptport.c
 	PROFILER_MOVIE_REC,         // movie recording
 	PROFILER_LOGERROR,          // logerror
+	PROFILER_WORK_ITEM,         // osd_work_queue items (tracing only)
 	PROFILER_EXTRA,             // everything else
 
 	// the USER types are available to driver writers to profile
@@ -102,6 +110,9 @@ public:
 	// enable/disable
 	void enable(bool state = true)
 	{
+		// tracing relies on the FILO, so keep it running while a trace is active
+		if (tracing())
+			state = true;
 		if (state != enabled())
 		{
 			reset(state);
@@ -112,10 +123,48 @@ public:
 	void start(profile_type type) { if (enabled()) real_start(type); }
 	void stop() { if (enabled()) real_stop(); }
 
+	// tracing
+	bool tracing() const { return (m_trace_active != 0); }
+	void start_trace();
+	void stop_trace(running_machine &machine, const char *filename);
+	int thread_base() { return atomic_add32(&m_trace_threads, WORK_MAX_THREADS) - WORK_MAX_THREADS; }
+	void thread_start(profile_type type, int threadid) { if (tracing()) trace_event(type, 'B', threadid + 1, get_profile_ticks()); }
+	void thread_stop(profile_type type, int threadid) { if (tracing()) trace_event(type, 'E', threadid + 1, get_profile_ticks()); }
+
 private:
 	void reset(bool enabled);
 	void update_text(running_machine &machine);
 
+	//-------------------------------------------------
+	//  trace_event - record a single trace event;
+	//  slots are claimed atomically so this is safe
+	//  to call from any thread
+	//-------------------------------------------------
+	void trace_event(int type, char phase, int thread, osd_ticks_t ticks)
+	{
+		// announce ourselves before checking, so stop_trace can wait us out
+		atomic_increment32(&m_trace_writers);
+		if (m_trace_active != 0)
+		{
+			// claim a slot, but never move past the end of the buffer
+			INT32 index = m_trace_next;
+			while (index < m_trace.count() && compare_exchange32(&m_trace_next, index, index + 1) != index)
+				index = m_trace_next;
+
+			if (index < m_trace.count())
+			{
+				trace_entry &entry = m_trace[index];
+				entry.ticks = ticks;
+				entry.type = type;
+				entry.phase = phase;
+				entry.thread = thread;
+			}
+			else
+				atomic_increment32((INT32 volatile *)&m_trace_dropped);
+		}
+		atomic_decrement32(&m_trace_writers);
+	}
+
 	//-------------------------------------------------
 	//  real_start - mark the beginning of a
 	//  profiler entry
@@ -129,6 +178,10 @@ private:
 		// get current tick count
 		osd_ticks_t curticks = get_profile_ticks();
 
+		// record the event if tracing
+		if (UNEXPECTED(tracing()))
+			trace_event(type, 'B', 0, curticks);
+
 		// update previous entry
 		m_data[m_filoptr->type] += curticks - m_filoptr->start;
 
@@ -152,6 +205,10 @@ private:
 		// get current tick count
 		osd_ticks_t curticks = get_profile_ticks();
 
+		// record the event if tracing
+		if (UNEXPECTED(tracing()))
+			trace_event(m_filoptr->type, 'E', 0, curticks);
+
 		// account for the time taken
 		m_data[m_filoptr->type] += curticks - m_filoptr->start;
 
@@ -169,12 +226,29 @@ private:
 		osd_ticks_t     start;                      // start time
 	};
 
+	// an entry in the trace buffer
+	struct trace_entry
+	{
+		osd_ticks_t     ticks;                      // time of the event
+		UINT16          type;                       // type of entry
+		char            phase;                      // 'B' for begin, 'E' for end
+		UINT32          thread;                     // 0 for the main thread, else work thread + 1
+	};
+
 	// internal state
 	filo_entry *        m_filoptr;                  // current FILO index
 	astring             m_text;                     // profiler text
 	attotime            m_text_time;                // profiler text last update
 	filo_entry          m_filo[32];                 // array of FILO entries
 	osd_ticks_t         m_data[PROFILER_TOTAL + 1]; // array of data
+	dynamic_array<trace_entry> m_trace;             // trace event buffer
+	INT32 volatile      m_trace_active;             // non-zero while events are being recorded
+	INT32 volatile      m_trace_writers;            // threads currently inside trace_event
+	INT32 volatile      m_trace_threads;            // thread ids handed out to work queues
+	INT32 volatile      m_trace_next;               // next free trace entry
+	UINT32 volatile     m_trace_dropped;            // events that did not fit in the buffer
+	osd_ticks_t         m_trace_osd_start;          // osd_ticks() when tracing started
+	osd_ticks_t         m_trace_profile_start;      // get_profile_ticks() when tracing started
 };
 
 
@@ -196,6 +270,14 @@ public:
 	// start/stop
 	void start(profile_type type) { }
 	void stop() { }
+
+	// tracing
+	bool tracing() const { return false; }
+	void start_trace() { }
+	void stop_trace(running_machine &machine, const char *filename) { }
+	int thread_base() { return 0; }
+	void thread_start(profile_type type, int threadid) { }
+	void thread_stop(profile_type type, int threadid) { }
 };
 
 
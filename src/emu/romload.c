@@ -57,6 +57,45 @@ private:
 };
 
 
+// a copy of a loaded ROM region, kept across hard resets by -romcache
+class rom_cache_entry
+{
+	friend class simple_list<rom_cache_entry>;
+
+public:
+	rom_cache_entry(const char *tag, const device_t &device, memory_region &region)
+		: m_next(NULL),
+			m_tag(tag),
+			m_device(device.shortname()),
+			m_bios(device.system_bios()),
+			m_width(region.width()),
+			m_endianness(region.endianness())
+	{
+		m_data.resize(region.bytes());
+		memcpy(m_data, region.base(), region.bytes());
+	}
+
+	rom_cache_entry *next() const { return m_next; }
+	const UINT8 *data() const { return m_data; }
+
+	// the same tag is only the same data if the same device with the same BIOS put it there
+	bool matches(const char *tag, const device_t &device, const memory_region &region) const
+	{
+		return m_tag == tag && m_device == device.shortname() && m_bios == device.system_bios() &&
+			m_data.count() == region.bytes() && m_width == region.width() && m_endianness == region.endianness();
+	}
+
+private:
+	rom_cache_entry *   m_next;                 /* pointer to next in the list */
+	astring             m_tag;                  /* full region tag */
+	astring             m_device;               /* shortname of the owning device */
+	UINT8               m_bios;                 /* system BIOS the region was loaded with */
+	UINT8               m_width;                /* region width */
+	endianness_t        m_endianness;           /* region endianness */
+	dynamic_buffer      m_data;                 /* post-processed contents */
+};
+
+
 struct romload_private
 {
 	running_machine &machine() const { assert(m_machine != NULL); return *m_machine; }
@@ -88,6 +127,16 @@ struct romload_private
 
 static void rom_exit(running_machine &machine);
 
+
+
+/***************************************************************************
+    GLOBAL VARIABLES
+***************************************************************************/
+
+/* ROM regions kept across hard resets, and the system they belong to */
+static simple_list<rom_cache_entry> s_rom_cache;
+static const game_driver *s_rom_cache_system;
+
 /***************************************************************************
     HELPERS (also used by devimage.c)
  ***************************************************************************/
@@ -1399,6 +1448,8 @@ void load_software_part_region(device_t &device, software_list_device &swlist, c
 static void process_region_list(romload_private *romdata)
 {
 	astring regiontag;
+	bool usecache = romdata->machine().options().rom_cache();
+	dynamic_array<bool> cached;
 
 	/* loop until we hit the end */
 	device_iterator deviter(romdata->machine().root_device());
@@ -1425,6 +1476,20 @@ static void process_region_list(romload_private *romdata)
 				romdata->region = romdata->machine().memory().region_alloc(regiontag, regionlength, width, endianness);
 				LOG(("Allocated %X bytes @ %p\n", romdata->region->bytes(), romdata->region->base()));
 
+				/* if we loaded this exact region last time, just copy it back */
+				rom_cache_entry *entry = NULL;
+				if (usecache)
+					for (entry = s_rom_cache.first(); entry != NULL; entry = entry->next())
+						if (entry->matches(regiontag, *device, *romdata->region))
+							break;
+				cached.append(entry != NULL);
+				if (entry != NULL)
+				{
+					LOG(("Copied from ROM cache\n"));
+					memcpy(romdata->region->base(), entry->data(), romdata->region->bytes());
+					continue;
+				}
+
 				/* clear the region if it's requested */
 				if (ROMREGION_ISERASE(region))
 					memset(romdata->region->base(), ROMREGION_GETERASEVAL(region), romdata->region->bytes());
@@ -1443,16 +1508,38 @@ static void process_region_list(romload_private *romdata)
 				process_rom_entries(romdata, device->shortname(), region, region + 1, device, FALSE);
 			}
 			else if (ROMREGION_ISDISKDATA(region))
+			{
+				cached.append(false);
 				process_disk_entries(romdata, regiontag, region, region + 1, NULL);
+			}
+			else
+				cached.append(false);
 		}
 
-	/* now go back and post-process all the regions */
+	/* now go back and post-process all the regions; cached ones were stored that way */
+	int regionnum = 0;
 	for (device_t *device = deviter.first(); device != NULL; device = deviter.next())
 		for (const rom_entry *region = rom_first_region(*device); region != NULL; region = rom_next_region(region))
-		{
-			rom_region_name(regiontag, *device, region);
-			region_post_process(romdata, regiontag, ROMREGION_ISINVERTED(region));
-		}
+			if (!cached[regionnum++])
+			{
+				rom_region_name(regiontag, *device, region);
+				region_post_process(romdata, regiontag, ROMREGION_ISINVERTED(region));
+			}
+
+	/* remember what we just loaded, but only if it all came through cleanly */
+	if (usecache && romdata->errors == 0 && romdata->warnings == 0 && romdata->knownbad == 0)
+	{
+		regionnum = 0;
+		for (device_t *device = deviter.first(); device != NULL; device = deviter.next())
+			for (const rom_entry *region = rom_first_region(*device); region != NULL; region = rom_next_region(region))
+				if (!cached[regionnum++] && ROMREGION_ISROMDATA(region))
+				{
+					rom_region_name(regiontag, *device, region);
+					memory_region *memregion = romdata->machine().root_device().memregion(regiontag);
+					if (memregion != NULL)
+						s_rom_cache.append(*global_alloc(rom_cache_entry(regiontag, *device, *memregion)));
+				}
+	}
 }
 
 
@@ -1474,6 +1561,11 @@ void rom_init(running_machine &machine)
 	/* reset the romdata struct */
 	romdata->m_machine = &machine;
 
+	/* cached regions are only good for the system that loaded them */
+	if (!machine.options().rom_cache() || s_rom_cache_system != &machine.system())
+		rom_cache_flush();
+	s_rom_cache_system = &machine.system();
+
 	/* figure out which BIOS we are using */
 	device_iterator deviter(romdata->machine().config().root_device());
 	for (device_t *device = deviter.first(); device != NULL; device = deviter.next()) {
@@ -1515,6 +1607,18 @@ static void rom_exit(running_machine &machine)
 }
 
 
+/*-------------------------------------------------
+    rom_cache_flush - free all ROM regions kept
+    by -romcache
+-------------------------------------------------*/
+
+void rom_cache_flush()
+{
+	s_rom_cache.reset();
+	s_rom_cache_system = NULL;
+}
+
+
 /*-------------------------------------------------
     rom_load_warnings - return the number of
     warnings we generated
@@ -261,6 +261,9 @@ struct rom_entry
 /* load the ROMs and open the disk images associated with the given machine */
 void rom_init(running_machine &machine);
 
+/* free any ROM regions kept across hard resets */
+void rom_cache_flush();
+
 /* return the number of warnings we generated */
 int rom_load_warnings(running_machine &machine);
 astring& software_load_warnings_message(running_machine &machine);
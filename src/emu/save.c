@@ -301,6 +301,24 @@ save_error save_manager::write_file(emu_file &file)
 }
 
 
+//-------------------------------------------------
+//  state_crc - compute a CRC over the data that
+//  would be written to a state file right now
+//-------------------------------------------------
+
+UINT32 save_manager::state_crc()
+{
+	// call the pre-save functions so the data is the same as in a save
+	for (state_callback *func = m_presave_list.first(); func != NULL; func = func->next())
+		func->m_func();
+
+	UINT32 crc = 0;
+	for (state_entry *entry = m_entry_list.first(); entry != NULL; entry = entry->next())
+		crc = crc32(crc, (UINT8 *)entry->m_data, entry->m_typesize * entry->m_typecount);
+	return crc;
+}
+
+
 //-------------------------------------------------
 //  signature - compute the signature, which
 //  is a CRC over the structure of the data
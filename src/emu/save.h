@@ -146,6 +146,9 @@ public:
 	save_error write_file(emu_file &file);
 	save_error read_file(emu_file &file);
 
+	// state hashing
+	UINT32 state_crc();
+
 private:
 	// internal helpers
 	UINT32 signature() const;
@@ -12,6 +12,7 @@
 #include "emuopts.h"
 #include "png.h"
 #include "rendutil.h"
+#include <zlib.h>
 
 
 
@@ -850,6 +851,35 @@ void screen_device::vblank_end()
 }
 
 
+//-------------------------------------------------
+//  frame_crc - compute a CRC of the visible area
+//  of the bitmap on display, plus its palette;
+//  skipped or unchanged frames hash the bitmap
+//  that is still being shown
+//-------------------------------------------------
+
+UINT32 screen_device::frame_crc()
+{
+	// update_quads only hands bitmaps to the texture for live raster screens;
+	// anything else has nothing on display, so use the bitmap being drawn
+	bool presented = machine().render().is_live(*this) && m_type != SCREEN_TYPE_VECTOR && (m_video_attributes & VIDEO_SELF_RENDER) == 0;
+	screen_bitmap &curbitmap = m_bitmap[presented ? m_curtexture : m_curbitmap];
+	if (!curbitmap.valid())
+		return 0;
+
+	// the palette counts too, or fades on indexed screens would go unnoticed
+	UINT32 crc = 0;
+	palette_t *palette = curbitmap.palette();
+	if (palette != NULL)
+		crc = crc32(crc, reinterpret_cast<const UINT8 *>(palette->entry_list_adjusted()), palette->num_colors() * sizeof(rgb_t));
+
+	bitmap_t &bitmap = curbitmap;
+	for (int y = m_visarea.min_y; y <= m_visarea.max_y; y++)
+		crc = crc32(crc, reinterpret_cast<UINT8 *>(bitmap.raw_pixptr(y, m_visarea.min_x)), m_visarea.width() * bitmap.bpp() / 8);
+	return crc;
+}
+
+
 //-------------------------------------------------
 //  update_quads - set up the quads for this
 //  screen
@@ -212,6 +212,7 @@ public:
 	bool update_partial(int scanline);
 	void update_now();
 	void reset_partial_updates();
+	UINT32 frame_crc();
 
 	// additional helpers
 	void register_vblank_callback(vblank_state_delegate vblank_callback);
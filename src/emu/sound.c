@@ -13,6 +13,7 @@
 #include "osdepend.h"
 #include "config.h"
 #include "sound/wavwrite.h"
+#include <zlib.h>
 
 
 
@@ -765,6 +766,8 @@ sound_manager::sound_manager(running_machine &machine)
 		m_attenuation(0),
 		m_nosound_mode(!machine.options().sound()),
 		m_wavfile(NULL),
+		m_mix_hashing(machine.options().frame_hash()[0] != 0),
+		m_mix_crc(0),
 		m_update_attoseconds(STREAMS_UPDATE_ATTOTIME.attoseconds),
 		m_last_update(attotime::zero)
 {
@@ -772,8 +775,8 @@ sound_manager::sound_manager(running_machine &machine)
 	const char *wavfile = machine.options().wav_write();
 	const char *avifile = machine.options().avi_write();
 
-	// handle -nosound and lower sample rate if not recording WAV or AVI
-	if (m_nosound_mode && wavfile[0] == 0 && avifile[0] == 0)
+	// handle -nosound and lower sample rate if not recording WAV or AVI, or hashing the mix
+	if (m_nosound_mode && wavfile[0] == 0 && avifile[0] == 0 && !m_mix_hashing)
 		machine.m_sample_rate = 11025;
 
 	// count the mixers
@@ -1029,6 +1032,8 @@ void sound_manager::update(void *ptr, int param)
 		machine().video().add_sound_to_recording(finalmix, finalmix_offset / 2);
 		if (m_wavfile != NULL)
 			wav_add_data_16(m_wavfile, finalmix, finalmix_offset);
+		if (m_mix_hashing)
+			m_mix_crc = crc32(m_mix_crc, reinterpret_cast<UINT8 *>(finalmix), finalmix_offset * sizeof(INT16));
 	}
 
 	// see if we ticked over to the next second
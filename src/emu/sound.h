@@ -196,6 +196,7 @@ public:
 	sound_stream *first_stream() const { return m_stream_list.first(); }
 	attotime last_update() const { return m_last_update; }
 	attoseconds_t update_attoseconds() const { return m_update_attoseconds; }
+	UINT32 mix_crc() const { return m_mix_crc; }
 
 	// stream creation
 	sound_stream *stream_alloc(device_t &device, int inputs, int outputs, int sample_rate, void *param = NULL, sound_stream::stream_update_func callback = NULL);
@@ -206,6 +207,7 @@ public:
 	void debugger_mute(bool turn_off = true) { mute(turn_off, MUTE_REASON_DEBUGGER); }
 	void system_mute(bool turn_off = true) { mute(turn_off, MUTE_REASON_SYSTEM); }
 	void system_enable(bool turn_on = true) { mute(!turn_on, MUTE_REASON_SYSTEM); }
+	void reset_mix_crc() { m_mix_crc = 0; }
 
 	// user gain controls
 	bool indexed_mixer_input(int index, mixer_input &info) const;
@@ -235,6 +237,8 @@ private:
 	int                 m_nosound_mode;
 
 	wav_file *          m_wavfile;
+	bool                m_mix_hashing;          // keep a CRC of the final mix for -framehash
+	UINT32              m_mix_crc;              // CRC of the final mix since the last reset
 
 	// streams data
 	simple_list<sound_stream> m_stream_list;    // list of streams
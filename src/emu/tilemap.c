@@ -184,25 +184,21 @@ inline void tilemap_t::scanline_draw_opaque_ind16(UINT16 *dest, const UINT16 *so
 
 inline void tilemap_t::scanline_draw_masked_ind16(UINT16 *dest, const UINT16 *source, const UINT8 *maskptr, int mask, int value, int count, UINT8 *pri, UINT32 pcode)
 {
-	int pal = pcode >> 16;
-
-	// priority case
-	if ((pcode & 0xffff) != 0xff00)
-	{
-		for (int i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-			{
-				dest[i] = source[i] + pal;
-				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-			}
-	}
-
-	// no priority case
-	else
+	// find runs of opaque pixels and hand each one to the opaque renderer
+	for (int i = 0; i < count; )
 	{
-		for (int i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-				dest[i] = source[i] + pal;
+		// skip over transparent pixels
+		while (i < count && (maskptr[i] & mask) != value)
+			i++;
+
+		// find the end of the opaque run
+		int start = i;
+		while (i < count && (maskptr[i] & mask) == value)
+			i++;
+
+		// draw the run if there is one
+		if (i > start)
+			scanline_draw_opaque_ind16(dest + start, source + start, i - start, pri + start, pcode);
 	}
 }
 
@@ -243,25 +239,21 @@ inline void tilemap_t::scanline_draw_opaque_rgb32(UINT32 *dest, const UINT16 *so
 
 inline void tilemap_t::scanline_draw_masked_rgb32(UINT32 *dest, const UINT16 *source, const UINT8 *maskptr, int mask, int value, int count, const rgb_t *pens, UINT8 *pri, UINT32 pcode)
 {
-	const rgb_t *clut = &pens[pcode >> 16];
-
-	// priority case
-	if ((pcode & 0xffff) != 0xff00)
-	{
-		for (int i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-			{
-				dest[i] = clut[source[i]];
-				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-			}
-	}
-
-	// no priority case
-	else
+	// find runs of opaque pixels and hand each one to the opaque renderer
+	for (int i = 0; i < count; )
 	{
-		for (int i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-				dest[i] = clut[source[i]];
+		// skip over transparent pixels
+		while (i < count && (maskptr[i] & mask) != value)
+			i++;
+
+		// find the end of the opaque run
+		int start = i;
+		while (i < count && (maskptr[i] & mask) == value)
+			i++;
+
+		// draw the run if there is one
+		if (i > start)
+			scanline_draw_opaque_rgb32(dest + start, source + start, i - start, pens, pri + start, pcode);
 	}
 }
 
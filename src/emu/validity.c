@@ -1029,6 +1029,12 @@ void validity_checker::validate_devices()
 	{
 		for (const device_slot_option *option = slot->first_option(); option != NULL; option = option->next())
 		{
+			// many systems share the same slot cards; only instantiate each type once per run
+			astring typekey;
+			typekey.printf("slot/%p", (void *)option->devtype());
+			if (already_checked(typekey))
+				continue;
+
 			astring temptag("_");
 			temptag.cat(option->name());
 			device_t *dev = const_cast<machine_config &>(*m_current_config).device_add(&m_current_config->root_device(), temptag.cstr(), option->devtype(), 0);
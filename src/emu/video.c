@@ -104,7 +104,8 @@ video_manager::video_manager(running_machine &machine)
 		m_avifile(NULL),
 		m_movie_frame_period(attotime::zero),
 		m_movie_next_frame_time(attotime::zero),
-		m_movie_frame(0)
+		m_movie_frame(0),
+		m_framehash_state(machine.options().frame_hash_state())
 {
 	// request a callback upon exiting
 	machine.add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(FUNC(video_manager::exit), this));
@@ -151,6 +152,11 @@ video_manager::video_manager(running_machine &machine)
 	if (filename[0] != 0)
 		begin_recording(filename, MF_AVI);
 
+	// start logging frame hashes if specified
+	filename = machine.options().frame_hash();
+	if (filename[0] != 0)
+		framehash_begin(filename);
+
 	// if no screens, create a periodic timer to drive updates
 	if (machine.primary_screen == NULL)
 	{
@@ -199,6 +205,10 @@ void video_manager::frame_update(bool debug)
 	{
 		bool anything_changed = finish_screen_updates();
 
+		// hash the frame as the screens now present it
+		if (m_framehash_file != NULL && !debug && !machine().paused())
+			framehash_update();
+
 		// if none of the screens changed and we haven't skipped too many frames in a row,
 		// mark this frame as skipped to prevent throttling; this helps for games that
 		// don't update their screen at the monitor refresh rate
@@ -507,6 +517,9 @@ void video_manager::exit()
 	// stop recording any movie
 	end_recording();
 
+	// close the frame hash log
+	m_framehash_file.reset();
+
 	// free the snapshot target
 	machine().render().target_free(m_snap_target);
 	m_snap_bitmap.reset();
@@ -518,10 +531,47 @@ void video_manager::exit()
 		double final_real_time = (double)m_overall_real_seconds + (double)m_overall_real_ticks / (double)tps;
 		double final_emu_time = m_overall_emutime.as_double();
 		mame_printf_info("Average speed: %.2f%% (%d seconds)\n", 100 * final_emu_time / final_real_time, (m_overall_emutime + attotime(0, ATTOSECONDS_PER_SECOND / 2)).seconds);
+
+		// append machine-readable results if requested
+		const char *filename = machine().options().bench_results();
+		if (filename[0] != 0)
+			write_bench_results(filename, final_emu_time, final_real_time);
 	}
 }
 
 
+//-------------------------------------------------
+//  write_bench_results - append a single JSON
+//  object line describing this run to the given
+//  file, creating it if needed
+//-------------------------------------------------
+
+void video_manager::write_bench_results(const char *filename, double emu_time, double real_time)
+{
+	// open for append, creating the file only if it doesn't exist yet
+	emu_file file(OPEN_FLAG_READ | OPEN_FLAG_WRITE);
+	file_error filerr = file.open(filename);
+	if (filerr != FILERR_NONE)
+	{
+		file.set_openflags(OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+		filerr = file.open(filename);
+	}
+	if (filerr != FILERR_NONE)
+	{
+		mame_printf_error("Unable to open benchmark results file '%s'\n", filename);
+		return;
+	}
+	file.seek(0, SEEK_END);
+
+	// count frames on the primary screen, if there is one
+	screen_device *screen = machine().first_screen();
+	UINT64 frames = (screen != NULL) ? screen->frame_number() : 0;
+
+	file.printf("{\"system\":\"%s\",\"emulated_seconds\":%.6f,\"real_seconds\":%.6f,\"speed\":%.4f,\"frames\":%u,\"frames_per_second\":%.3f}\n",
+			machine().system().name, emu_time, real_time, emu_time / real_time, (UINT32)frames, frames / real_time);
+}
+
+
 //-------------------------------------------------
 //  screenless_update_callback - update generator
 //  when there are no screens to drive it
@@ -1245,6 +1295,74 @@ void video_manager::record_frame()
 	g_profiler.stop();
 }
 
+
+//-------------------------------------------------
+//  framehash_begin - open the -framehash log and
+//  write its header, which names each 32-bit
+//  CRC stored per frame
+//-------------------------------------------------
+
+void video_manager::framehash_begin(const char *name)
+{
+	m_framehash_file.reset(global_alloc(emu_file(machine().options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS)));
+	if (m_framehash_file->open(name) != FILERR_NONE)
+	{
+		mame_printf_error("Unable to open frame hash file %s\n", name);
+		m_framehash_file.reset();
+		return;
+	}
+
+	// one component per screen, then the sound mix and optionally the state
+	dynamic_array<const char *> names;
+	screen_device_iterator iter(machine().root_device());
+	for (screen_device *screen = iter.first(); screen != NULL; screen = iter.next())
+		names.append(screen->tag());
+	names.append("sound");
+	if (m_framehash_state)
+		names.append("state");
+
+	// header is the magic, a version byte and the component count, then each name
+	UINT8 header[10];
+	memcpy(header, "MAMEFHSH", 8);
+	header[8] = 1;
+	header[9] = names.count();
+	m_framehash_file->write(header, sizeof(header));
+	for (int index = 0; index < names.count(); index++)
+	{
+		UINT8 length = MIN(strlen(names[index]), 255);
+		m_framehash_file->write(&length, 1);
+		m_framehash_file->write(names[index], length);
+	}
+}
+
+
+//-------------------------------------------------
+//  framehash_update - append the CRCs for the
+//  frame that just completed; called after
+//  finish_screen_updates so each screen hashes
+//  what it handed to the renderer
+//-------------------------------------------------
+
+void video_manager::framehash_update()
+{
+	screen_device_iterator iter(machine().root_device());
+	for (screen_device *screen = iter.first(); screen != NULL; screen = iter.next())
+	{
+		UINT32 crc = LITTLE_ENDIANIZE_INT32(screen->frame_crc());
+		m_framehash_file->write(&crc, sizeof(crc));
+	}
+
+	UINT32 crc = LITTLE_ENDIANIZE_INT32(machine().sound().mix_crc());
+	m_framehash_file->write(&crc, sizeof(crc));
+	machine().sound().reset_mix_crc();
+
+	if (m_framehash_state)
+	{
+		crc = LITTLE_ENDIANIZE_INT32(machine().save().state_crc());
+		m_framehash_file->write(&crc, sizeof(crc));
+	}
+}
+
 //-------------------------------------------------
 //	toggle_throttle
 //-------------------------------------------------
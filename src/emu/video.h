@@ -96,6 +96,7 @@ public:
 private:
 	// internal helpers
 	void exit();
+	void write_bench_results(const char *filename, double emu_time, double real_time);
 	void screenless_update_callback(void *ptr, int param);
 	void postload();
 
@@ -118,6 +119,10 @@ private:
 	file_error open_next(emu_file &file, const char *extension);
 	void record_frame();
 
+	// frame hashing helpers
+	void framehash_begin(const char *name);
+	void framehash_update();
+
 	// internal state
 	running_machine &   m_machine;                  // reference to our machine
 
@@ -172,6 +177,10 @@ private:
 	attotime            m_movie_next_frame_time;    // time of next frame
 	UINT32              m_movie_frame;              // current movie frame number
 
+	// frame hashing
+	auto_pointer<emu_file> m_framehash_file;        // handle to the open -framehash log
+	bool                m_framehash_state;          // include a save state CRC in each frame?
+
 	static const UINT8      s_skiptable[FRAMESKIP_LEVELS][FRAMESKIP_LEVELS];
 
 	static const attoseconds_t ATTOSECONDS_PER_SPEED_UPDATE = ATTOSECONDS_PER_SECOND / 4;
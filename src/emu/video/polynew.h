@@ -58,11 +58,13 @@
 #define POLYFLAG_INCLUDE_BOTTOM_EDGE        0x01
 #define POLYFLAG_INCLUDE_RIGHT_EDGE         0x02
 #define POLYFLAG_NO_WORK_QUEUE              0x04
+#define POLYFLAG_BIN_BY_BUCKET              0x08
 
 #define SCANLINES_PER_BUCKET                8
 #define CACHE_LINE_SIZE                     64          // this is a general guess
 #define TOTAL_BUCKETS                       (512 / SCANLINES_PER_BUCKET)
 #define UNITS_PER_POLY                      (100 / SCANLINES_PER_BUCKET)
+#define UNITS_PER_BIN                       32          // binned mode dispatches a bucket once it collects this many
 
 
 
@@ -172,6 +174,15 @@ private:
 		extent_t            extent[SCANLINES_PER_BUCKET]; // array of scanline extents
 	};
 
+	// a bucket's worth of work units, dispatched as a single item in binned mode
+	struct bin_info
+	{
+		poly_manager *      m_owner;                // pointer back to the poly manager
+		UINT32              m_first;                // index of the first unit in the bucket
+		UINT32              m_units;                // units collected since the last dispatch
+		volatile INT32      m_busy;                 // non-zero while the dispatched item is running
+	};
+
 	// class for managing an array of items
 	template<class _Type, int _Count>
 	class poly_array
@@ -244,13 +255,38 @@ private:
 		return polygon;
 	}
 
+	void queue_units(UINT32 startunit)
+	{
+		if (m_queue == NULL)
+			return;
+
+		// in binned mode, a bucket goes out once it is full, as long as its previous
+		// dispatch has finished; everything else waits for flush
+		if (m_flags & POLYFLAG_BIN_BY_BUCKET)
+		{
+			for (UINT32 unitnum = startunit; unitnum < m_unit.count(); unitnum++)
+			{
+				UINT32 bucketnum = ((UINT32)m_unit[unitnum].scanline / SCANLINES_PER_BUCKET) % TOTAL_BUCKETS;
+				bin_info &bin = m_bin[bucketnum];
+				if (++bin.m_units >= UNITS_PER_BIN && bin.m_busy == 0)
+					dispatch_bin(bucketnum);
+			}
+		}
+		else
+			osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
+	}
+
 	static void *work_item_callback(void *param, int threadid);
+	static void *bin_item_callback(void *param, int threadid);
+	void dispatch_bin(int bucketnum);
+	void flush();
 	void presave() { wait("pre-save"); }
 
 	// queue management
 	running_machine &   m_machine;
 	screen_device *     m_screen;
 	osd_work_queue *    m_queue;                    // work queue
+	int                 m_trace_thread;             // first profiler trace thread id for our queue
 
 	// arrays
 	polygon_array       m_polygon;                  // array of polygons
@@ -262,11 +298,13 @@ private:
 
 	// buckets
 	UINT16              m_unit_bucket[TOTAL_BUCKETS]; // buckets for tracking unit usage
+	bin_info            m_bin[TOTAL_BUCKETS];       // per-bucket work items for binned mode
 
 	// statistics
 	UINT32              m_tiles;                    // number of tiles queued
 	UINT32              m_triangles;                // number of triangles queued
 	UINT32              m_quads;                    // number of quads queued
+	UINT32              m_bins;                     // number of buckets dispatched in binned mode
 	UINT64              m_pixels;                   // number of pixels rendered
 #if KEEP_STATISTICS
 	UINT32              m_conflicts[WORK_MAX_THREADS]; // number of conflicts found, per thread
@@ -284,12 +322,14 @@ poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::poly_manager(runnin
 	: m_machine(machine),
 		m_screen(NULL),
 		m_queue(NULL),
+		m_trace_thread(g_profiler.thread_base()),
 		m_polygon(machine, *this),
 		m_object(machine, *this),
 		m_unit(machine, *this),
 		m_flags(flags),
 		m_triangles(0),
 		m_quads(0),
+		m_bins(0),
 		m_pixels(0)
 {
 #if KEEP_STATISTICS
@@ -297,6 +337,10 @@ poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::poly_manager(runnin
 	memset(m_resolved, 0, sizeof(m_resolved));
 #endif
 
+	// start with all buckets empty
+	memset(m_unit_bucket, 0xff, sizeof(m_unit_bucket));
+	memset(m_bin, 0, sizeof(m_bin));
+
 	// create the work queue
 	if (!(flags & POLYFLAG_NO_WORK_QUEUE))
 		m_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
@@ -311,12 +355,14 @@ poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::poly_manager(screen
 	: m_machine(screen.machine()),
 		m_screen(&screen),
 		m_queue(NULL),
+		m_trace_thread(g_profiler.thread_base()),
 		m_polygon(screen.machine(), *this),
 		m_object(screen.machine(), *this),
 		m_unit(screen.machine(), *this),
 		m_flags(flags),
 		m_triangles(0),
 		m_quads(0),
+		m_bins(0),
 		m_pixels(0)
 {
 #if KEEP_STATISTICS
@@ -324,6 +370,10 @@ poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::poly_manager(screen
 	memset(m_resolved, 0, sizeof(m_resolved));
 #endif
 
+	// start with all buckets empty
+	memset(m_unit_bucket, 0xff, sizeof(m_unit_bucket));
+	memset(m_bin, 0, sizeof(m_bin));
+
 	// create the work queue
 	if (!(flags & POLYFLAG_NO_WORK_QUEUE))
 		m_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
@@ -353,6 +403,8 @@ poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::~poly_manager()
 	// output global stats
 	printf("Total triangles = %d\n", m_triangles);
 	printf("Total quads = %d\n", m_quads);
+	if (m_flags & POLYFLAG_BIN_BY_BUCKET)
+		printf("Total bins = %d\n", m_bins);
 	if (m_pixels > 1000000000)
 		printf("Total pixels   = %d%09d\n", (UINT32)(m_pixels / 1000000000), (UINT32)(m_pixels % 1000000000));
 	else
@@ -378,6 +430,8 @@ poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::~poly_manager()
 template<typename _BaseType, class _ObjectData, int _MaxParams, int _MaxPolys>
 void *poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::work_item_callback(void *param, int threadid)
 {
+	int tracethread = ((work_unit *)param)->polygon->m_owner->m_trace_thread + threadid;
+	g_profiler.thread_start(PROFILER_WORK_ITEM, tracethread);
 	while (1)
 	{
 		work_unit &unit = *(work_unit *)param;
@@ -429,10 +483,118 @@ void *poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::work_item_cal
 			break;
 		param = &polygon.m_owner->m_unit[orig_count_next];
 	}
+	g_profiler.thread_stop(PROFILER_WORK_ITEM, tracethread);
+	return NULL;
+}
+
+
+//-------------------------------------------------
+//  bin_item_callback - process all the units in
+//  a bucket in submission order
+//-------------------------------------------------
+
+template<typename _BaseType, class _ObjectData, int _MaxParams, int _MaxPolys>
+void *poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::bin_item_callback(void *param, int threadid)
+{
+	bin_info &bin = *(bin_info *)param;
+	unit_array &units = bin.m_owner->m_unit;
+	g_profiler.thread_start(PROFILER_WORK_ITEM, bin.m_owner->m_trace_thread + threadid);
+
+	// the upper 16 bits of count_next link forward to the next unit in the bucket
+	for (UINT32 unitnum = bin.m_first; ; )
+	{
+		work_unit &unit = units[unitnum];
+		polygon_info &polygon = *unit.polygon;
+		int count = unit.count_next & 0xffff;
+
+		// iterate over extents
+		for (int curscan = 0; curscan < count; curscan++)
+			polygon.m_callback(unit.scanline + curscan, unit.extent[curscan], *polygon.m_object, threadid);
+
+		// unit 0 is never anyone's successor, so it marks the end of the chain
+		unitnum = unit.count_next >> 16;
+		if (unitnum == 0)
+			break;
+	}
+	g_profiler.thread_stop(PROFILER_WORK_ITEM, bin.m_owner->m_trace_thread + threadid);
+
+	// the bucket may now be dispatched again
+	atomic_exchange32(&bin.m_busy, 0);
 	return NULL;
 }
 
 
+//-------------------------------------------------
+//  dispatch_bin - in binned mode, send off the
+//  units collected in a bucket as a single item
+//-------------------------------------------------
+
+template<typename _BaseType, class _ObjectData, int _MaxParams, int _MaxPolys>
+void poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::dispatch_bin(int bucketnum)
+{
+	UINT32 unitnum = m_unit_bucket[bucketnum];
+	if (unitnum == 0xffff)
+		return;
+
+	// walk the bucket's chain backwards, building forward links as we go
+	UINT32 next = 0;
+	while (1)
+	{
+		work_unit &unit = m_unit[unitnum];
+		unit.count_next = (unit.count_next & 0xffff) | (next << 16);
+		if (unit.previtem == 0xffff)
+			break;
+		next = unitnum;
+		unitnum = unit.previtem;
+	}
+
+	// the units already sent off are never revisited, so start a fresh chain
+	bin_info &bin = m_bin[bucketnum];
+	bin.m_owner = this;
+	bin.m_first = unitnum;
+	bin.m_units = 0;
+	m_unit_bucket[bucketnum] = 0xffff;
+	m_bins++;
+
+	// enqueue the bucket, or run it immediately if we have no queue; buckets never
+	// overlap, and only one item per bucket is in flight, so there are no conflicts
+	if (m_queue != NULL)
+	{
+		bin.m_busy = 1;
+		osd_work_item_queue(m_queue, bin_item_callback, &bin, WORK_ITEM_FLAG_AUTO_RELEASE);
+	}
+	else
+		bin_item_callback(&bin, 0);
+}
+
+
+//-------------------------------------------------
+//  flush - in binned mode, dispatch everything
+//  accumulated so far with one work item per
+//  bucket; no-op otherwise
+//-------------------------------------------------
+
+template<typename _BaseType, class _ObjectData, int _MaxParams, int _MaxPolys>
+void poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::flush()
+{
+	if (!(m_flags & POLYFLAG_BIN_BY_BUCKET))
+		return;
+
+	// a bucket must not have two items in flight, so let any that are still
+	// running finish before sending the rest of their units
+	if (m_queue != NULL)
+		for (int bucketnum = 0; bucketnum < TOTAL_BUCKETS; bucketnum++)
+			if (m_unit_bucket[bucketnum] != 0xffff && m_bin[bucketnum].m_busy != 0)
+			{
+				osd_work_queue_wait(m_queue, osd_ticks_per_second() * 100);
+				break;
+			}
+
+	for (int bucketnum = 0; bucketnum < TOTAL_BUCKETS; bucketnum++)
+		dispatch_bin(bucketnum);
+}
+
+
 //-------------------------------------------------
 //  wait - stall until all work is complete
 //-------------------------------------------------
@@ -446,12 +608,16 @@ void poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::wait(const cha
 	if (LOG_WAITS)
 		time = get_profile_ticks();
 
+	// dispatch anything that has been binned
+	if (m_flags & POLYFLAG_BIN_BY_BUCKET)
+		flush();
+
 	// wait for all pending work items to complete
 	if (m_queue != NULL)
 		osd_work_queue_wait(m_queue, osd_ticks_per_second() * 100);
 
 	// if we don't have a queue, just run the whole list now
-	else
+	else if (!(m_flags & POLYFLAG_BIN_BY_BUCKET))
 		for (int unitnum = 0; unitnum < m_unit.count(); unitnum++)
 			work_item_callback(&m_unit[unitnum], 0);
 
@@ -614,8 +780,7 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_tile(
 	}
 
 	// enqueue the work items
-	if (m_queue != NULL)
-		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
+	queue_units(startunit);
 
 	// return the total number of pixels in the triangle
 	m_tiles++;
@@ -802,8 +967,7 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_trian
 	}
 
 	// enqueue the work items
-	if (m_queue != NULL)
-		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
+	queue_units(startunit);
 
 	// return the total number of pixels in the triangle
 	m_triangles++;
@@ -918,8 +1082,7 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_trian
 	}
 
 	// enqueue the work items
-	if (m_queue != NULL)
-		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
+	queue_units(startunit);
 
 	// return the total number of pixels in the object
 	m_triangles++;
@@ -1117,8 +1280,7 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_polyg
 	}
 
 	// enqueue the work items
-	if (m_queue != NULL)
-		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
+	queue_units(startunit);
 
 	// return the total number of pixels in the triangle
 	m_quads++;
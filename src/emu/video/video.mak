@@ -355,15 +355,6 @@ ifneq ($(filter PC_VGA,$(VIDEOS)),)
 VIDEOOBJS+= $(VIDEOOBJ)/pc_vga.o
 endif
 
-#-------------------------------------------------
-#
-#@src/emu/video/poly.h,VIDEOS += POLY
-#-------------------------------------------------
-
-ifneq ($(filter POLY,$(VIDEOS)),)
-VIDEOOBJS+= $(VIDEOOBJ)/poly.o
-endif
-
 #-------------------------------------------------
 #
 #@src/emu/video/psx.h,VIDEOS += PSX
@@ -1355,7 +1355,7 @@ static const UINT8 dither_matrix_2x2[16] =
  *************************************/
 
 struct voodoo_state;
-struct poly_extra_data;
+struct raster_info;
 
 
 struct rgba
@@ -1387,6 +1387,8 @@ struct voodoo_stats
 	INT32               swaps;                  /* total swaps */
 	INT32               stalls;                 /* total stalls */
 	INT32               total_triangles;        /* total triangles */
+	INT32               total_generic_pixels;   /* total pixels sent to generic rasterizers */
+	INT32               total_special_pixels;   /* total pixels sent to specialized rasterizers */
 	INT32               total_pixels_in;        /* total pixels in */
 	INT32               total_pixels_out;       /* total pixels out */
 	INT32               total_chroma_fail;      /* total chroma fail */
@@ -1606,27 +1608,10 @@ struct dac_state
 };
 
 
-struct raster_info
-{
-	raster_info *       next;                   /* pointer to next entry with the same hash */
-	poly_draw_scanline_func callback;           /* callback pointer */
-	UINT8               is_generic;             /* TRUE if this is one of the generic rasterizers */
-	UINT8               display;                /* display index */
-	UINT32              hits;                   /* how many hits (pixels) we've used this for */
-	UINT32              polys;                  /* how many polys we've used this for */
-	UINT32              eff_color_path;         /* effective fbzColorPath value */
-	UINT32              eff_alpha_mode;         /* effective alphaMode value */
-	UINT32              eff_fog_mode;           /* effective fogMode value */
-	UINT32              eff_fbz_mode;           /* effective fbzMode value */
-	UINT32              eff_tex_mode_0;         /* effective textureMode value for TMU #0 */
-	UINT32              eff_tex_mode_1;         /* effective textureMode value for TMU #1 */
-};
-
-
 struct poly_extra_data
 {
-	voodoo_state *      state;                  /* pointer back to the voodoo state */
 	raster_info *       info;                   /* pointer to rasterizer information */
+	UINT16 *            destbase;               /* base of the destination buffer */
 
 	INT16               ax, ay;                 /* vertex A x,y (12.4) */
 	INT32               startr, startg, startb, starta; /* starting R,G,B,A (12.12) */
@@ -1659,6 +1644,27 @@ struct poly_extra_data
 };
 
 
+typedef poly_manager<float, poly_extra_data, 1, 64> voodoo_poly_manager;
+typedef void (*voodoo_raster_func)(voodoo_state *v, INT32 y, const voodoo_poly_manager::extent_t &extent, const poly_extra_data &extra, int threadid);
+
+
+struct raster_info
+{
+	raster_info *       next;                   /* pointer to next entry with the same hash */
+	voodoo_raster_func  callback;               /* callback pointer */
+	UINT8               is_generic;             /* TRUE if this is one of the generic rasterizers */
+	UINT8               display;                /* display index */
+	UINT32              hits;                   /* how many hits (pixels) we've used this for */
+	UINT32              polys;                  /* how many polys we've used this for */
+	UINT32              eff_color_path;         /* effective fbzColorPath value */
+	UINT32              eff_alpha_mode;         /* effective alphaMode value */
+	UINT32              eff_fog_mode;           /* effective fogMode value */
+	UINT32              eff_fbz_mode;           /* effective fbzMode value */
+	UINT32              eff_tex_mode_0;         /* effective textureMode value for TMU #0 */
+	UINT32              eff_tex_mode_1;         /* effective textureMode value for TMU #1 */
+};
+
+
 struct banshee_info
 {
 	UINT32              io[0x40];               /* I/O registers */
@@ -1715,7 +1721,7 @@ struct voodoo_state
 	tmu_shared_state    tmushare;               /* TMU shared state */
 	banshee_info        banshee;                /* Banshee state */
 
-	poly_manager *      poly;                   /* polygon manager */
+	voodoo_poly_manager *poly;                  /* polygon manager */
 	stats_block *       thread_stats;           /* per-thread statistics */
 
 	voodoo_stats        stats;                  /* internal statistics */
@@ -3532,14 +3538,12 @@ while (0)
 
 #define RASTERIZER(name, TMUS, FBZCOLORPATH, FBZMODE, ALPHAMODE, FOGMODE, TEXMODE0, TEXMODE1) \
 																				\
-static void raster_##name(void *destbase, INT32 y, const poly_extent *extent, const void *extradata, int threadid) \
+static void raster_##name(voodoo_state *v, INT32 y, const voodoo_poly_manager::extent_t &extent, const poly_extra_data &extra, int threadid) \
 {                                                                               \
-	const poly_extra_data *extra = (const poly_extra_data *)extradata;          \
-	voodoo_state *v = extra->state;                                             \
 	stats_block *stats = &v->thread_stats[threadid];                            \
 	DECLARE_DITHER_POINTERS;                                                    \
-	INT32 startx = extent->startx;                                              \
-	INT32 stopx = extent->stopx;                                                \
+	INT32 startx = extent.startx;                                               \
+	INT32 stopx = extent.stopx;                                                 \
 	INT32 iterr, iterg, iterb, itera;                                           \
 	INT32 iterz;                                                                \
 	INT64 iterw, iterw0 = 0, iterw1 = 0;                                        \
@@ -3551,16 +3555,26 @@ static void raster_##name(void *destbase, INT32 y, const poly_extent *extent, co
 	INT32 scry;                                                                 \
 	INT32 x;                                                                    \
 																				\
+	/* latch the mode registers once per scanline; for the specialized */       \
+	/* rasterizers these are constants, for the generic ones this keeps */      \
+	/* them out of memory in the pixel loop */                                  \
+	const UINT32 r_fbzcp = (FBZCOLORPATH);                                      \
+	const UINT32 r_fbzmode = (FBZMODE);                                         \
+	const UINT32 r_alphamode = (ALPHAMODE);                                     \
+	const UINT32 r_fogmode = (FOGMODE);                                         \
+	const UINT32 r_texmode0 = (TEXMODE0);                                       \
+	const UINT32 r_texmode1 = (TEXMODE1);                                       \
+																				\
 	/* determine the screen Y */                                                \
 	scry = y;                                                                   \
-	if (FBZMODE_Y_ORIGIN(FBZMODE))                                              \
+	if (FBZMODE_Y_ORIGIN(r_fbzmode))                                            \
 		scry = (v->fbi.yorigin - y) & 0x3ff;                                    \
 																				\
 	/* compute dithering */                                                     \
-	COMPUTE_DITHER_POINTERS(FBZMODE, y);                                        \
+	COMPUTE_DITHER_POINTERS(r_fbzmode, y);                                      \
 																				\
 	/* apply clipping */                                                        \
-	if (FBZMODE_ENABLE_CLIPPING(FBZMODE))                                       \
+	if (FBZMODE_ENABLE_CLIPPING(r_fbzmode))                                     \
 	{                                                                           \
 		INT32 tempclip;                                                         \
 																				\
@@ -3591,29 +3605,29 @@ static void raster_##name(void *destbase, INT32 y, const poly_extent *extent, co
 	}                                                                           \
 																				\
 	/* get pointers to the target buffer and depth buffer */                    \
-	dest = (UINT16 *)destbase + scry * v->fbi.rowpixels;                        \
+	dest = extra.destbase + scry * v->fbi.rowpixels;                            \
 	depth = (v->fbi.auxoffs != ~0) ? ((UINT16 *)(v->fbi.ram + v->fbi.auxoffs) + scry * v->fbi.rowpixels) : NULL; \
 																				\
 	/* compute the starting parameters */                                       \
-	dx = startx - (extra->ax >> 4);                                             \
-	dy = y - (extra->ay >> 4);                                                  \
-	iterr = extra->startr + dy * extra->drdy + dx * extra->drdx;                \
-	iterg = extra->startg + dy * extra->dgdy + dx * extra->dgdx;                \
-	iterb = extra->startb + dy * extra->dbdy + dx * extra->dbdx;                \
-	itera = extra->starta + dy * extra->dady + dx * extra->dadx;                \
-	iterz = extra->startz + dy * extra->dzdy + dx * extra->dzdx;                \
-	iterw = extra->startw + dy * extra->dwdy + dx * extra->dwdx;                \
+	dx = startx - (extra.ax >> 4);                                              \
+	dy = y - (extra.ay >> 4);                                                   \
+	iterr = extra.startr + dy * extra.drdy + dx * extra.drdx;                   \
+	iterg = extra.startg + dy * extra.dgdy + dx * extra.dgdx;                   \
+	iterb = extra.startb + dy * extra.dbdy + dx * extra.dbdx;                   \
+	itera = extra.starta + dy * extra.dady + dx * extra.dadx;                   \
+	iterz = extra.startz + dy * extra.dzdy + dx * extra.dzdx;                   \
+	iterw = extra.startw + dy * extra.dwdy + dx * extra.dwdx;                   \
 	if (TMUS >= 1)                                                              \
 	{                                                                           \
-		iterw0 = extra->startw0 + dy * extra->dw0dy +   dx * extra->dw0dx;      \
-		iters0 = extra->starts0 + dy * extra->ds0dy + dx * extra->ds0dx;        \
-		itert0 = extra->startt0 + dy * extra->dt0dy + dx * extra->dt0dx;        \
+		iterw0 = extra.startw0 + dy * extra.dw0dy +   dx * extra.dw0dx;         \
+		iters0 = extra.starts0 + dy * extra.ds0dy + dx * extra.ds0dx;           \
+		itert0 = extra.startt0 + dy * extra.dt0dy + dx * extra.dt0dx;           \
 	}                                                                           \
 	if (TMUS >= 2)                                                              \
 	{                                                                           \
-		iterw1 = extra->startw1 + dy * extra->dw1dy +   dx * extra->dw1dx;      \
-		iters1 = extra->starts1 + dy * extra->ds1dy + dx * extra->ds1dx;        \
-		itert1 = extra->startt1 + dy * extra->dt1dy + dx * extra->dt1dx;        \
+		iterw1 = extra.startw1 + dy * extra.dw1dy +   dx * extra.dw1dx;         \
+		iters1 = extra.starts1 + dy * extra.ds1dy + dx * extra.ds1dx;           \
+		itert1 = extra.startt1 + dy * extra.dt1dy + dx * extra.dt1dx;           \
 	}                                                                           \
 																				\
 	/* loop in X */                                                             \
@@ -3623,52 +3637,52 @@ static void raster_##name(void *destbase, INT32 y, const poly_extent *extent, co
 		rgb_union texel = { 0 };                                                \
 																				\
 		/* pixel pipeline part 1 handles depth testing and stippling */         \
-		PIXEL_PIPELINE_BEGIN(v, stats, x, y, FBZCOLORPATH, FBZMODE,             \
+		PIXEL_PIPELINE_BEGIN(v, stats, x, y, r_fbzcp, r_fbzmode,                \
 								iterz, iterw);                                  \
 																				\
 		/* run the texture pipeline on TMU1 to produce a value in texel */      \
 		/* note that they set LOD min to 8 to "disable" a TMU */                \
 		if (TMUS >= 2 && v->tmu[1].lodmin < (8 << 8))                           \
-			TEXTURE_PIPELINE(&v->tmu[1], x, dither4, TEXMODE1, texel,           \
-								v->tmu[1].lookup, extra->lodbase1,              \
+			TEXTURE_PIPELINE(&v->tmu[1], x, dither4, r_texmode1, texel,         \
+								v->tmu[1].lookup, extra.lodbase1,               \
 								iters1, itert1, iterw1, texel);                 \
 																				\
 		/* run the texture pipeline on TMU0 to produce a final */               \
 		/* result in texel */                                                   \
 		/* note that they set LOD min to 8 to "disable" a TMU */                \
 		if (TMUS >= 1 && v->tmu[0].lodmin < (8 << 8))                           \
-			TEXTURE_PIPELINE(&v->tmu[0], x, dither4, TEXMODE0, texel,           \
-								v->tmu[0].lookup, extra->lodbase0,              \
+			TEXTURE_PIPELINE(&v->tmu[0], x, dither4, r_texmode0, texel,         \
+								v->tmu[0].lookup, extra.lodbase0,               \
 								iters0, itert0, iterw0, texel);                 \
 																				\
 		/* colorpath pipeline selects source colors and does blending */        \
-		CLAMPED_ARGB(iterr, iterg, iterb, itera, FBZCOLORPATH, iterargb);       \
-		COLORPATH_PIPELINE(v, stats, FBZCOLORPATH, FBZMODE, ALPHAMODE, texel,   \
+		CLAMPED_ARGB(iterr, iterg, iterb, itera, r_fbzcp, iterargb);            \
+		COLORPATH_PIPELINE(v, stats, r_fbzcp, r_fbzmode, r_alphamode, texel,    \
 							iterz, iterw, iterargb);                            \
 																				\
 		/* pixel pipeline part 2 handles fog, alpha, and final output */        \
 		PIXEL_PIPELINE_END(v, stats, dither, dither4, dither_lookup, x, dest, depth, \
-							FBZMODE, FBZCOLORPATH, ALPHAMODE, FOGMODE,          \
+							r_fbzmode, r_fbzcp, r_alphamode, r_fogmode,         \
 							iterz, iterw, iterargb);                            \
 																				\
 		/* update the iterated parameters */                                    \
-		iterr += extra->drdx;                                                   \
-		iterg += extra->dgdx;                                                   \
-		iterb += extra->dbdx;                                                   \
-		itera += extra->dadx;                                                   \
-		iterz += extra->dzdx;                                                   \
-		iterw += extra->dwdx;                                                   \
+		iterr += extra.drdx;                                                    \
+		iterg += extra.dgdx;                                                    \
+		iterb += extra.dbdx;                                                    \
+		itera += extra.dadx;                                                    \
+		iterz += extra.dzdx;                                                    \
+		iterw += extra.dwdx;                                                    \
 		if (TMUS >= 1)                                                          \
 		{                                                                       \
-			iterw0 += extra->dw0dx;                                             \
-			iters0 += extra->ds0dx;                                             \
-			itert0 += extra->dt0dx;                                             \
+			iterw0 += extra.dw0dx;                                              \
+			iters0 += extra.ds0dx;                                              \
+			itert0 += extra.dt0dx;                                              \
 		}                                                                       \
 		if (TMUS >= 2)                                                          \
 		{                                                                       \
-			iterw1 += extra->dw1dx;                                             \
-			iters1 += extra->ds1dx;                                             \
-			itert1 += extra->dt1dx;                                             \
+			iterw1 += extra.dw1dx;                                              \
+			iters1 += extra.ds1dx;                                              \
+			itert1 += extra.dt1dx;                                              \
 		}                                                                       \
 	}                                                                           \
 }
@@ -145,7 +145,7 @@ bits(7:4) and bit(24)), X, and Y:
 #define EXPAND_RASTERIZERS
 
 #include "emu.h"
-#include "video/poly.h"
+#include "video/polynew.h"
 #include "video/rgbutil.h"
 #include "voodoo.h"
 #include "vooddefs.h"
@@ -165,7 +165,6 @@ bits(7:4) and bit(24)), X, and Y:
 #define LOG_FIFO            (0)
 #define LOG_FIFO_VERBOSE    (0)
 #define LOG_REGISTERS       (0)
-#define LOG_WAITS           (0)
 #define LOG_LFB             (0)
 #define LOG_TEXTURE_RAM     (0)
 #define LOG_RASTERIZERS     (0)
@@ -233,10 +232,10 @@ static raster_info *find_rasterizer(voodoo_state *v, int texcount);
 static void dump_rasterizer_stats(voodoo_state *v);
 
 /* generic rasterizers */
-static void raster_fastfill(void *dest, INT32 scanline, const poly_extent *extent, const void *extradata, int threadid);
-static void raster_generic_0tmu(void *dest, INT32 scanline, const poly_extent *extent, const void *extradata, int threadid);
-static void raster_generic_1tmu(void *dest, INT32 scanline, const poly_extent *extent, const void *extradata, int threadid);
-static void raster_generic_2tmu(void *dest, INT32 scanline, const poly_extent *extent, const void *extradata, int threadid);
+static void raster_fastfill(voodoo_state *v, INT32 scanline, const voodoo_poly_manager::extent_t &extent, const poly_extra_data &extra, int threadid);
+static void raster_generic_0tmu(voodoo_state *v, INT32 scanline, const voodoo_poly_manager::extent_t &extent, const poly_extra_data &extra, int threadid);
+static void raster_generic_1tmu(voodoo_state *v, INT32 scanline, const voodoo_poly_manager::extent_t &extent, const poly_extra_data &extra, int threadid);
+static void raster_generic_2tmu(voodoo_state *v, INT32 scanline, const voodoo_poly_manager::extent_t &extent, const poly_extra_data &extra, int threadid);
 
 
 
@@ -913,6 +912,8 @@ static void swap_buffers(voodoo_state *v)
 		statsptr += sprintf(statsptr, "Stal:%6d\n", v->stats.stalls);
 		statsptr += sprintf(statsptr, "Rend:%6d%%\n", pixelcount * 100 / screen_area);
 		statsptr += sprintf(statsptr, "Poly:%6d\n", v->stats.total_triangles);
+		if (v->stats.total_generic_pixels + v->stats.total_special_pixels != 0)
+			statsptr += sprintf(statsptr, "Spec:%6d%%\n", (int)((INT64)v->stats.total_special_pixels * 100 / (v->stats.total_generic_pixels + v->stats.total_special_pixels)));
 		statsptr += sprintf(statsptr, "PxIn:%6d\n", v->stats.total_pixels_in);
 		statsptr += sprintf(statsptr, "POut:%6d\n", v->stats.total_pixels_out);
 		statsptr += sprintf(statsptr, "Clip:%6d\n", v->stats.total_clipped);
@@ -935,6 +936,8 @@ static void swap_buffers(voodoo_state *v)
 	/* update statistics */
 	v->stats.stalls = 0;
 	v->stats.total_triangles = 0;
+	v->stats.total_generic_pixels = 0;
+	v->stats.total_special_pixels = 0;
 	v->stats.total_pixels_in = 0;
 	v->stats.total_pixels_out = 0;
 	v->stats.total_chroma_fail = 0;
@@ -2460,21 +2463,21 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 
 		/* mask off invalid bits for different cards */
 		case fbzColorPath:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (v->type < TYPE_VOODOO_2)
 				data &= 0x0fffffff;
 			if (chips & 1) v->reg[fbzColorPath].u = data;
 			break;
 
 		case fbzMode:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (v->type < TYPE_VOODOO_2)
 				data &= 0x001fffff;
 			if (chips & 1) v->reg[fbzMode].u = data;
 			break;
 
 		case fogMode:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (v->type < TYPE_VOODOO_2)
 				data &= 0x0000003f;
 			if (chips & 1) v->reg[fogMode].u = data;
@@ -2503,7 +2506,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 
 		/* other commands */
 		case nopCMD:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (data & 1)
 				reset_counters(v);
 			if (data & 2)
@@ -2515,12 +2518,12 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 			break;
 
 		case swapbufferCMD:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			cycles = swapbuffer(v, data);
 			break;
 
 		case userIntrCMD:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			//fatalerror("userIntrCMD\n");
 
 			v->reg[intrCtrl].u |= 0x1800;
@@ -2535,7 +2538,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case clutData:
 			if (v->type <= TYPE_VOODOO_2 && (chips & 1))
 			{
-				poly_wait(v->poly, v->regnames[regnum]);
+				v->poly->wait(v->regnames[regnum]);
 				if (!FBIINIT1_VIDEO_TIMING_RESET(v->reg[fbiInit1].u))
 				{
 					int index = data >> 24;
@@ -2554,7 +2557,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case dacData:
 			if (v->type <= TYPE_VOODOO_2 && (chips & 1))
 			{
-				poly_wait(v->poly, v->regnames[regnum]);
+				v->poly->wait(v->regnames[regnum]);
 				if (!(data & 0x800))
 					dacdata_w(&v->dac, (data >> 8) & 7, data & 0xff);
 				else
@@ -2569,7 +2572,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case videoDimensions:
 			if (v->type <= TYPE_VOODOO_2 && (chips & 1))
 			{
-				poly_wait(v->poly, v->regnames[regnum]);
+				v->poly->wait(v->regnames[regnum]);
 				v->reg[regnum].u = data;
 				if (v->reg[hSync].u != 0 && v->reg[vSync].u != 0 && v->reg[videoDimensions].u != 0)
 				{
@@ -2658,7 +2661,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 
 		/* fbiInit0 can only be written if initEnable says we can -- Voodoo/Voodoo2 only */
 		case fbiInit0:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (v->type <= TYPE_VOODOO_2 && (chips & 1) && INITEN_ENABLE_HW_INIT(v->pci.init_enable))
 			{
 				v->reg[fbiInit0].u = data;
@@ -2682,7 +2685,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case fbiInit1:
 		case fbiInit2:
 		case fbiInit4:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (v->type <= TYPE_VOODOO_2 && (chips & 1) && INITEN_ENABLE_HW_INIT(v->pci.init_enable))
 			{
 				v->reg[regnum].u = data;
@@ -2692,7 +2695,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 			break;
 
 		case fbiInit3:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (v->type <= TYPE_VOODOO_2 && (chips & 1) && INITEN_ENABLE_HW_INIT(v->pci.init_enable))
 			{
 				v->reg[regnum].u = data;
@@ -2706,7 +2709,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 /*      case swapPending: -- Banshee */
 			if (v->type == TYPE_VOODOO_2 && (chips & 1) && INITEN_ENABLE_HW_INIT(v->pci.init_enable))
 			{
-				poly_wait(v->poly, v->regnames[regnum]);
+				v->poly->wait(v->regnames[regnum]);
 				v->reg[regnum].u = data;
 				v->fbi.cmdfifo[0].enable = FBIINIT7_CMDFIFO_ENABLE(data);
 				v->fbi.cmdfifo[0].count_holes = !FBIINIT7_DISABLE_CMDFIFO_HOLES(data);
@@ -2719,7 +2722,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case cmdFifoBaseAddr:
 			if (v->type == TYPE_VOODOO_2 && (chips & 1))
 			{
-				poly_wait(v->poly, v->regnames[regnum]);
+				v->poly->wait(v->regnames[regnum]);
 				v->reg[regnum].u = data;
 				v->fbi.cmdfifo[0].base = (data & 0x3ff) << 12;
 				v->fbi.cmdfifo[0].end = (((data >> 16) & 0x3ff) + 1) << 12;
@@ -2795,7 +2798,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case nccTable+9:
 		case nccTable+10:
 		case nccTable+11:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (chips & 2) ncc_table_write(&v->tmu[0].ncc[0], regnum - nccTable, data);
 			if (chips & 4) ncc_table_write(&v->tmu[1].ncc[0], regnum - nccTable, data);
 			break;
@@ -2812,7 +2815,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case nccTable+21:
 		case nccTable+22:
 		case nccTable+23:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (chips & 2) ncc_table_write(&v->tmu[0].ncc[1], regnum - (nccTable+12), data);
 			if (chips & 4) ncc_table_write(&v->tmu[1].ncc[1], regnum - (nccTable+12), data);
 			break;
@@ -2850,7 +2853,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case fogTable+29:
 		case fogTable+30:
 		case fogTable+31:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (chips & 1)
 			{
 				int base = 2 * (regnum - fogTable);
@@ -2869,7 +2872,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case texBaseAddr_1:
 		case texBaseAddr_2:
 		case texBaseAddr_3_8:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (chips & 2)
 			{
 				v->tmu[0].reg[regnum].u = data;
@@ -2893,7 +2896,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case color0:
 		case clipLowYHighY:
 		case clipLeftRight:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			/* fall through to default implementation */
 
 		/* by default, just feed the data to the chips */
@@ -3156,7 +3159,7 @@ static INT32 lfb_w(voodoo_state *v, offs_t offset, UINT32 data, UINT32 mem_mask,
 	depthmax = (v->fbi.mask + 1 - v->fbi.auxoffs) / 2;
 
 	/* wait for any outstanding work to finish */
-	poly_wait(v->poly, "LFB Write");
+	v->poly->wait("LFB Write");
 
 	/* simple case: no pipeline */
 	if (!LFBMODE_ENABLE_PIXEL_PIPELINE(v->reg[lfbMode].u))
@@ -3311,7 +3314,7 @@ static INT32 texture_w(voodoo_state *v, offs_t offset, UINT32 data)
 		fatalerror("Texture direct write!\n");
 
 	/* wait for any outstanding work to finish */
-	poly_wait(v->poly, "Texture write");
+	v->poly->wait("Texture write");
 
 	/* update texture info if dirty */
 	if (t->regdirty)
@@ -3955,7 +3958,7 @@ static UINT32 lfb_r(voodoo_state *v, offs_t offset, int forcefront)
 		return 0xffffffff;
 
 	/* wait for any outstanding work to finish */
-	poly_wait(v->poly, "LFB read");
+	v->poly->wait("LFB read");
 
 	/* compute the data */
 	data = buffer[bufoffs + 0] | (buffer[bufoffs + 1] << 16);
@@ -4879,7 +4882,7 @@ static void common_start_voodoo(device_t *device, UINT8 type)
 	v->pci.stall_callback.resolve(config->stall,*device);
 
 	/* create a multiprocessor work queue */
-	v->poly = poly_alloc(device->machine(), 64, sizeof(poly_extra_data), 0);
+	v->poly = auto_alloc(device->machine(), voodoo_poly_manager(device->machine()));
 	v->thread_stats = auto_alloc_array(device->machine(), stats_block, WORK_MAX_THREADS);
 
 	/* create a table of precomputed 1/n and log2(n) values */
@@ -5060,9 +5063,9 @@ static DEVICE_STOP( voodoo )
 {
 	voodoo_state *v = get_safe_token(device);
 
-	/* release the work queue, ensuring all work is finished */
+	/* make sure all work is finished before the work queue goes away */
 	if (v->poly != NULL)
-		poly_free(v->poly);
+		v->poly->wait("device stop");
 }
 
 
@@ -5091,7 +5094,7 @@ static INT32 fastfill(voodoo_state *v)
 	int ex = (v->reg[clipLeftRight].u >> 0) & 0x3ff;
 	int sy = (v->reg[clipLowYHighY].u >> 16) & 0x3ff;
 	int ey = (v->reg[clipLowYHighY].u >> 0) & 0x3ff;
-	poly_extent extents[64];
+	voodoo_poly_manager::extent_t extents[64];
 	UINT16 dithermatrix[16];
 	UINT16 *drawbuf = NULL;
 	UINT32 pixels = 0;
@@ -5146,13 +5149,13 @@ static INT32 fastfill(voodoo_state *v)
 	/* iterate over blocks of extents */
 	for (y = sy; y < ey; y += ARRAY_LENGTH(extents))
 	{
-		poly_extra_data *extra = (poly_extra_data *)poly_get_extra_data(v->poly);
+		poly_extra_data &extra = v->poly->object_data_alloc();
 		int count = MIN(ey - y, ARRAY_LENGTH(extents));
 
-		extra->state = v;
-		memcpy(extra->dither, dithermatrix, sizeof(extra->dither));
+		extra.destbase = drawbuf;
+		memcpy(extra.dither, dithermatrix, sizeof(extra.dither));
 
-		pixels += poly_render_triangle_custom(v->poly, drawbuf, global_cliprect, raster_fastfill, y, count, extents);
+		pixels += v->poly->render_triangle_custom(global_cliprect, voodoo_poly_manager::render_delegate(FUNC(raster_fastfill), v), y, count, extents);
 	}
 
 	/* 2 pixels per clock */
@@ -5240,7 +5243,7 @@ static INT32 triangle(voodoo_state *v)
 	}
 
 	/* wait for any outstanding work to finish */
-//  poly_wait(v->poly, "triangle");
+//  v->poly->wait("triangle");
 
 	/* determine the draw buffer */
 	destbuf = (v->type >= TYPE_VOODOO_BANSHEE) ? 1 : FBZMODE_DRAW_BUFFER(v->reg[fbzMode].u);
@@ -5487,9 +5490,10 @@ static INT32 setup_and_draw_triangle(voodoo_state *v)
 
 static INT32 triangle_create_work_item(voodoo_state *v, UINT16 *drawbuf, int texcount)
 {
-	poly_extra_data *extra = (poly_extra_data *)poly_get_extra_data(v->poly);
+	poly_extra_data &extra = v->poly->object_data_alloc();
 	raster_info *info = find_rasterizer(v, texcount);
-	poly_vertex vert[3];
+	voodoo_poly_manager::vertex_t vert[3];
+	INT32 pixels;
 
 	/* fill in the vertex data */
 	vert[0].x = (float)v->fbi.ax * (1.0f / 16.0f);
@@ -5500,66 +5504,74 @@ static INT32 triangle_create_work_item(voodoo_state *v, UINT16 *drawbuf, int tex
 	vert[2].y = (float)v->fbi.cy * (1.0f / 16.0f);
 
 	/* fill in the extra data */
-	extra->state = v;
-	extra->info = info;
+	extra.info = info;
+	extra.destbase = drawbuf;
 
 	/* fill in triangle parameters */
-	extra->ax = v->fbi.ax;
-	extra->ay = v->fbi.ay;
-	extra->startr = v->fbi.startr;
-	extra->startg = v->fbi.startg;
-	extra->startb = v->fbi.startb;
-	extra->starta = v->fbi.starta;
-	extra->startz = v->fbi.startz;
-	extra->startw = v->fbi.startw;
-	extra->drdx = v->fbi.drdx;
-	extra->dgdx = v->fbi.dgdx;
-	extra->dbdx = v->fbi.dbdx;
-	extra->dadx = v->fbi.dadx;
-	extra->dzdx = v->fbi.dzdx;
-	extra->dwdx = v->fbi.dwdx;
-	extra->drdy = v->fbi.drdy;
-	extra->dgdy = v->fbi.dgdy;
-	extra->dbdy = v->fbi.dbdy;
-	extra->dady = v->fbi.dady;
-	extra->dzdy = v->fbi.dzdy;
-	extra->dwdy = v->fbi.dwdy;
+	extra.ax = v->fbi.ax;
+	extra.ay = v->fbi.ay;
+	extra.startr = v->fbi.startr;
+	extra.startg = v->fbi.startg;
+	extra.startb = v->fbi.startb;
+	extra.starta = v->fbi.starta;
+	extra.startz = v->fbi.startz;
+	extra.startw = v->fbi.startw;
+	extra.drdx = v->fbi.drdx;
+	extra.dgdx = v->fbi.dgdx;
+	extra.dbdx = v->fbi.dbdx;
+	extra.dadx = v->fbi.dadx;
+	extra.dzdx = v->fbi.dzdx;
+	extra.dwdx = v->fbi.dwdx;
+	extra.drdy = v->fbi.drdy;
+	extra.dgdy = v->fbi.dgdy;
+	extra.dbdy = v->fbi.dbdy;
+	extra.dady = v->fbi.dady;
+	extra.dzdy = v->fbi.dzdy;
+	extra.dwdy = v->fbi.dwdy;
 
 	/* fill in texture 0 parameters */
 	if (texcount > 0)
 	{
-		extra->starts0 = v->tmu[0].starts;
-		extra->startt0 = v->tmu[0].startt;
-		extra->startw0 = v->tmu[0].startw;
-		extra->ds0dx = v->tmu[0].dsdx;
-		extra->dt0dx = v->tmu[0].dtdx;
-		extra->dw0dx = v->tmu[0].dwdx;
-		extra->ds0dy = v->tmu[0].dsdy;
-		extra->dt0dy = v->tmu[0].dtdy;
-		extra->dw0dy = v->tmu[0].dwdy;
-		extra->lodbase0 = prepare_tmu(&v->tmu[0]);
+		extra.starts0 = v->tmu[0].starts;
+		extra.startt0 = v->tmu[0].startt;
+		extra.startw0 = v->tmu[0].startw;
+		extra.ds0dx = v->tmu[0].dsdx;
+		extra.dt0dx = v->tmu[0].dtdx;
+		extra.dw0dx = v->tmu[0].dwdx;
+		extra.ds0dy = v->tmu[0].dsdy;
+		extra.dt0dy = v->tmu[0].dtdy;
+		extra.dw0dy = v->tmu[0].dwdy;
+		extra.lodbase0 = prepare_tmu(&v->tmu[0]);
 		v->stats.texture_mode[TEXMODE_FORMAT(v->tmu[0].reg[textureMode].u)]++;
 
 		/* fill in texture 1 parameters */
 		if (texcount > 1)
 		{
-			extra->starts1 = v->tmu[1].starts;
-			extra->startt1 = v->tmu[1].startt;
-			extra->startw1 = v->tmu[1].startw;
-			extra->ds1dx = v->tmu[1].dsdx;
-			extra->dt1dx = v->tmu[1].dtdx;
-			extra->dw1dx = v->tmu[1].dwdx;
-			extra->ds1dy = v->tmu[1].dsdy;
-			extra->dt1dy = v->tmu[1].dtdy;
-			extra->dw1dy = v->tmu[1].dwdy;
-			extra->lodbase1 = prepare_tmu(&v->tmu[1]);
+			extra.starts1 = v->tmu[1].starts;
+			extra.startt1 = v->tmu[1].startt;
+			extra.startw1 = v->tmu[1].startw;
+			extra.ds1dx = v->tmu[1].dsdx;
+			extra.dt1dx = v->tmu[1].dtdx;
+			extra.dw1dx = v->tmu[1].dwdx;
+			extra.ds1dy = v->tmu[1].dsdy;
+			extra.dt1dy = v->tmu[1].dtdy;
+			extra.dw1dy = v->tmu[1].dwdy;
+			extra.lodbase1 = prepare_tmu(&v->tmu[1]);
 			v->stats.texture_mode[TEXMODE_FORMAT(v->tmu[1].reg[textureMode].u)]++;
 		}
 	}
 
 	/* farm the rasterization out to other threads */
+	pixels = v->poly->render_triangle(global_cliprect, voodoo_poly_manager::render_delegate(info->callback, "raster", v), 0, vert[0], vert[1], vert[2]);
+
+	/* track how much work each rasterizer is doing */
 	info->polys++;
-	return poly_render_triangle(v->poly, drawbuf, global_cliprect, info->callback, 0, &vert[0], &vert[1], &vert[2]);
+	info->hits += pixels;
+	if (info->is_generic)
+		v->stats.total_generic_pixels += pixels;
+	else
+		v->stats.total_special_pixels += pixels;
+	return pixels;
 }
 
 
@@ -5821,13 +5833,11 @@ void voodoo_3_device::device_start()
     implementation of the 'fastfill' command
 -------------------------------------------------*/
 
-static void raster_fastfill(void *destbase, INT32 y, const poly_extent *extent, const void *extradata, int threadid)
+static void raster_fastfill(voodoo_state *v, INT32 y, const voodoo_poly_manager::extent_t &extent, const poly_extra_data &extra, int threadid)
 {
-	const poly_extra_data *extra = (const poly_extra_data *)extradata;
-	voodoo_state *v = extra->state;
 	stats_block *stats = &v->thread_stats[threadid];
-	INT32 startx = extent->startx;
-	INT32 stopx = extent->stopx;
+	INT32 startx = extent.startx;
+	INT32 stopx = extent.stopx;
 	int scry, x;
 
 	/* determine the screen Y */
@@ -5838,9 +5848,9 @@ static void raster_fastfill(void *destbase, INT32 y, const poly_extent *extent,
 	/* fill this RGB row */
 	if (FBZMODE_RGB_BUFFER_MASK(v->reg[fbzMode].u))
 	{
-		const UINT16 *ditherow = &extra->dither[(y & 3) * 4];
+		const UINT16 *ditherow = &extra.dither[(y & 3) * 4];
 		UINT64 expanded = *(UINT64 *)ditherow;
-		UINT16 *dest = (UINT16 *)destbase + scry * v->fbi.rowpixels;
+		UINT16 *dest = extra.destbase + scry * v->fbi.rowpixels;
 
 		for (x = startx; x < stopx && (x & 3) != 0; x++)
 			dest[x] = ditherow[x & 3];
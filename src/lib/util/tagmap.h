@@ -41,8 +41,10 @@ extern INT32 g_tagmap_finds;
 //  TYPE DEFINITIONS
 //**************************************************************************
 
-// generally used for small tables, though the hash size can be increased
-// as necessary; good primes are: 53, 97, 193, 389, 769, 1543, 3079, 6151, etc
+// an open-addressed table of tags; each slot keeps the full hash next to the
+// entry pointer, so probes rarely touch the entries themselves; _HashSize is
+// the initial number of slots (rounded up to a power of 2), and the table
+// doubles whenever it becomes half full
 template<class _ElementType, int _HashSize = 53>
 class tagmap_t
 {
@@ -60,8 +62,7 @@ public:
 	public:
 		// construction/destruction
 		entry_t(const char *tag, UINT32 fullhash, _ElementType object)
-			: m_next(NULL),
-				m_fullhash(fullhash),
+			: m_fullhash(fullhash),
 				m_tag(tag),
 				m_object(object) { }
 
@@ -74,19 +75,17 @@ public:
 
 	private:
 		// internal helpers
-		entry_t *next() const { return m_next; }
 		UINT32 fullhash() const { return m_fullhash; }
 
 		// internal state
-		entry_t *       m_next;
 		UINT32          m_fullhash;
 		astring         m_tag;
 		_ElementType    m_object;
 	};
 
 	// construction/destruction
-	tagmap_t() { memset(m_table, 0, sizeof(m_table)); }
-	~tagmap_t() { reset(); }
+	tagmap_t() : m_slots(NULL), m_mask(0), m_shift(32), m_count(0) { }
+	~tagmap_t() { reset(); global_free_array(m_slots); }
 
 	// core hashing function
 	UINT32 hash(const char *string) const
@@ -100,9 +99,13 @@ public:
 	// empty the list
 	void reset()
 	{
-		for (UINT32 hashindex = 0; hashindex < ARRAY_LENGTH(m_table); hashindex++)
-			while (m_table[hashindex] != NULL)
-				remove_common(&m_table[hashindex]);
+		for (UINT32 index = 0; m_slots != NULL && index <= m_mask; index++)
+			if (m_slots[index].m_entry != NULL)
+			{
+				global_free(m_slots[index].m_entry);
+				m_slots[index].m_entry = NULL;
+			}
+		m_count = 0;
 	}
 
 	// add/remove
@@ -113,18 +116,17 @@ public:
 	void remove(const char *tag)
 	{
 		UINT32 fullhash = hash(tag);
-		for (entry_t **entryptr = &m_table[fullhash % ARRAY_LENGTH(m_table)]; *entryptr != NULL; entryptr = &(*entryptr)->m_next)
-			if ((*entryptr)->fullhash() == fullhash && (*entryptr)->tag() == tag)
-				return remove_common(entryptr);
+		for (UINT32 index = first_slot(fullhash); m_slots != NULL && m_slots[index].m_entry != NULL; index = (index + 1) & m_mask)
+			if (m_slots[index].m_fullhash == fullhash && m_slots[index].m_entry->tag() == tag)
+				return remove_slot(index);
 	}
 
 	// remove by object
 	void remove(_ElementType object)
 	{
-		for (UINT32 hashindex = 0; hashindex < ARRAY_LENGTH(m_table); hashindex++)
-			for (entry_t **entryptr = &m_table[hashindex]; *entryptr != NULL; entryptr = &(*entryptr)->m_next)
-				if ((*entryptr)->object() == object)
-					return remove_common(entryptr);
+		for (UINT32 index = 0; m_slots != NULL && index <= m_mask; index++)
+			if (m_slots[index].m_entry != NULL && m_slots[index].m_entry->object() == object)
+				return remove_slot(index);
 	}
 
 	// find by tag
@@ -136,9 +138,10 @@ public:
 #ifdef MAME_DEBUG
 		atomic_increment32(&g_tagmap_finds);
 #endif
-		for (entry_t *entry = m_table[fullhash % ARRAY_LENGTH(m_table)]; entry != NULL; entry = entry->next())
-			if (entry->fullhash() == fullhash && entry->tag() == tag)
-				return entry->object();
+		if (m_slots != NULL)
+			for (UINT32 index = first_slot(fullhash); m_slots[index].m_entry != NULL; index = (index + 1) & m_mask)
+				if (m_slots[index].m_fullhash == fullhash && m_slots[index].m_entry->tag() == tag)
+					return m_slots[index].m_entry->object();
 		return _ElementType(NULL);
 	}
 
@@ -149,9 +152,10 @@ public:
 		atomic_increment32(&g_tagmap_finds);
 #endif
 		UINT32 fullhash = hash(tag);
-		for (entry_t *entry = m_table[fullhash % ARRAY_LENGTH(m_table)]; entry != NULL; entry = entry->next())
-			if (entry->fullhash() == fullhash)
-				return entry->object();
+		if (m_slots != NULL)
+			for (UINT32 index = first_slot(fullhash); m_slots[index].m_entry != NULL; index = (index + 1) & m_mask)
+				if (m_slots[index].m_fullhash == fullhash)
+					return m_slots[index].m_entry->object();
 		return NULL;
 	}
 
@@ -161,34 +165,49 @@ public:
 	// return next object in the table
 	entry_t *next(entry_t *after) const
 	{
-		// if there's another item in this hash bucket, just return it
-		if (after != NULL && after->next() != NULL)
-			return after->next();
-
-		// otherwise scan forward for the next bucket with an entry
-		UINT32 firstindex = (after != NULL) ? (after->fullhash() % ARRAY_LENGTH(m_table) + 1) : 0;
-		for (UINT32 hashindex = firstindex; hashindex < ARRAY_LENGTH(m_table); hashindex++)
-			if (m_table[hashindex] != NULL)
-				return m_table[hashindex];
+		if (m_slots == NULL)
+			return NULL;
+
+		// find the slot holding the previous entry
+		UINT32 firstindex = 0;
+		if (after != NULL)
+		{
+			firstindex = first_slot(after->fullhash());
+			while (m_slots[firstindex].m_entry != after)
+				firstindex = (firstindex + 1) & m_mask;
+			firstindex++;
+		}
+
+		// scan forward for the next occupied slot
+		for (UINT32 index = firstindex; index <= m_mask; index++)
+			if (m_slots[index].m_entry != NULL)
+				return m_slots[index].m_entry;
 
 		// all out
 		return NULL;
 	}
 
 private:
+	// a slot in the table
+	struct slot_t
+	{
+		UINT32          m_fullhash;
+		entry_t *       m_entry;
+	};
+
 	// internal helpers
 	tagmap_error add_common(const char *tag, _ElementType object, bool replace_if_duplicate, bool unique_hash);
+	void remove_slot(UINT32 index);
+	void resize(UINT32 slots);
 
-	// remove an entry given a pointer to its pointer
-	void remove_common(entry_t **entryptr)
-	{
-		entry_t *entry = *entryptr;
-		*entryptr = entry->next();
-		global_free(entry);
-	}
+	// spread the hash over the table using its upper bits
+	UINT32 first_slot(UINT32 fullhash) const { return (m_shift < 32) ? (fullhash * 0x9e3779b9) >> m_shift : 0; }
 
 	// internal state
-	entry_t *       m_table[_HashSize];
+	slot_t *        m_slots;                // array of (1 << (32 - m_shift)) slots, or NULL
+	UINT32          m_mask;                 // number of slots minus 1
+	UINT8           m_shift;                // shift that maps a hash to a slot
+	UINT32          m_count;                // number of entries in the table
 };
 
 
@@ -310,24 +329,98 @@ template<class _ElementType, int _HashSize>
 tagmap_error tagmap_t<_ElementType, _HashSize>::add_common(const char *tag, _ElementType object, bool replace_if_duplicate, bool unique_hash)
 {
 	UINT32 fullhash = hash(tag);
-	UINT32 hashindex = fullhash % ARRAY_LENGTH(m_table);
 
 	// first make sure we don't have a duplicate
-	for (entry_t *entry = m_table[hashindex]; entry != NULL; entry = entry->next())
-		if (entry->fullhash() == fullhash)
-			if (unique_hash || entry->tag() == tag)
+	for (UINT32 index = first_slot(fullhash); m_slots != NULL && m_slots[index].m_entry != NULL; index = (index + 1) & m_mask)
+		if (m_slots[index].m_fullhash == fullhash)
+			if (unique_hash || m_slots[index].m_entry->tag() == tag)
 			{
 				if (replace_if_duplicate)
-					entry->set_object(object);
+					m_slots[index].m_entry->set_object(object);
 				return TMERR_DUPLICATE;
 			}
 
-	// now allocate a new entry and add to the head of the list
-	entry_t *entry = global_alloc(entry_t(tag, fullhash, object));
-	entry->m_next = m_table[hashindex];
-	m_table[hashindex] = entry;
+	// keep the table at most half full
+	if (m_slots == NULL)
+	{
+		UINT32 slots = 16;
+		while (slots < (UINT32)_HashSize)
+			slots <<= 1;
+		resize(slots);
+	}
+	else if ((m_count + 1) * 2 > m_mask + 1)
+		resize((m_mask + 1) * 2);
+
+	// now allocate a new entry and put it in the first free slot
+	UINT32 index = first_slot(fullhash);
+	while (m_slots[index].m_entry != NULL)
+		index = (index + 1) & m_mask;
+	m_slots[index].m_fullhash = fullhash;
+	m_slots[index].m_entry = global_alloc(entry_t(tag, fullhash, object));
+	m_count++;
 	return TMERR_NONE;
 }
 
 
+//-------------------------------------------------
+//  remove_slot - free the entry in a slot and
+//  shift any following entries of the same probe
+//  run back to fill the gap
+//-------------------------------------------------
+
+template<class _ElementType, int _HashSize>
+void tagmap_t<_ElementType, _HashSize>::remove_slot(UINT32 index)
+{
+	global_free(m_slots[index].m_entry);
+	m_count--;
+
+	UINT32 hole = index;
+	for (UINT32 cur = (index + 1) & m_mask; m_slots[cur].m_entry != NULL; cur = (cur + 1) & m_mask)
+	{
+		// an entry can move back if the hole lies between its home slot and where it is now
+		UINT32 home = first_slot(m_slots[cur].m_fullhash);
+		if (((cur - home) & m_mask) >= ((cur - hole) & m_mask))
+		{
+			m_slots[hole] = m_slots[cur];
+			hole = cur;
+		}
+	}
+	m_slots[hole].m_entry = NULL;
+}
+
+
+//-------------------------------------------------
+//  resize - reallocate the slots and reinsert all
+//  the existing entries
+//-------------------------------------------------
+
+template<class _ElementType, int _HashSize>
+void tagmap_t<_ElementType, _HashSize>::resize(UINT32 slots)
+{
+	slot_t *oldslots = m_slots;
+	UINT32 oldcount = (oldslots != NULL) ? m_mask + 1 : 0;
+
+	// allocate the new table
+	m_slots = global_alloc_array_clear(slot_t, slots);
+	m_mask = slots - 1;
+	m_shift = 32;
+	while (slots > 1)
+	{
+		m_shift--;
+		slots >>= 1;
+	}
+
+	// move the entries over
+	for (UINT32 oldindex = 0; oldindex < oldcount; oldindex++)
+		if (oldslots[oldindex].m_entry != NULL)
+		{
+			UINT32 index = first_slot(oldslots[oldindex].m_fullhash);
+			while (m_slots[index].m_entry != NULL)
+				index = (index + 1) & m_mask;
+			m_slots[index] = oldslots[oldindex];
+		}
+	global_free_array(oldslots);
+}
+
+
 #endif /* __TAGMAP_H__ */
@@ -17,9 +17,30 @@
 #include "emu.h"
 #include "cpu/m68000/m68000.h"
 #include "cpu/tms32010/tms32010.h"
-#include "video/poly.h"
+#include "video/polynew.h"
 
 
+struct atarisy4_polydata
+{
+	UINT16 color;
+	UINT16 *screen_ram;
+};
+
+class atarisy4_state;
+
+class atarisy4_renderer : public poly_manager<float, atarisy4_polydata, 2, 1024>
+{
+public:
+	atarisy4_renderer(atarisy4_state &state);
+
+	void draw_polygon(UINT16 color);
+
+private:
+	atarisy4_state &m_state;
+
+	void draw_scanline(INT32 scanline, const extent_t &extent, const atarisy4_polydata &extradata, int threadid);
+};
+
 class atarisy4_state : public driver_device
 {
 public:
@@ -40,7 +61,7 @@ public:
 	required_shared_ptr<UINT16> m_m68k_ram;
 	UINT16 *m_shared_ram[2];
 	required_shared_ptr<UINT16> m_screen_ram;
-	poly_manager *m_poly;
+	atarisy4_renderer *m_renderer;
 	DECLARE_WRITE16_MEMBER(gpu_w);
 	DECLARE_READ16_MEMBER(gpu_r);
 	DECLARE_READ16_MEMBER(m68k_shared_0_r);
@@ -65,7 +86,6 @@ public:
 	UINT32 screen_update_atarisy4(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect);
 	INTERRUPT_GEN_MEMBER(vblank_int);
 	void image_mem_to_screen( bool clip);
-	void draw_polygon(UINT16 color);
 	void execute_gpu_command();
 	inline UINT8 hex_to_ascii(UINT8 in);
 	void load_ldafile(address_space &space, const UINT8 *file);
@@ -136,14 +156,6 @@ struct gpu_
 
 
 
-
-struct poly_extra_data
-{
-	UINT16 color;
-	UINT16 *screen_ram;
-};
-
-
 /*************************************
  *
  *  Forward declarations
@@ -163,7 +175,7 @@ struct poly_extra_data
 
 void atarisy4_state::video_start()
 {
-	m_poly = poly_alloc(machine(), 1024, sizeof(poly_extra_data), POLYFLAG_NO_WORK_QUEUE);
+	m_renderer = auto_alloc(machine(), atarisy4_renderer(*this));
 }
 
 void atarisy4_state::video_reset()
@@ -260,37 +272,43 @@ void atarisy4_state::image_mem_to_screen(bool clip)
 	}
 }
 
-static void draw_scanline(void *dest, INT32 scanline, const poly_extent *extent, const void *extradata, int threadid)
+atarisy4_renderer::atarisy4_renderer(atarisy4_state &state)
+	: poly_manager<float, atarisy4_polydata, 2, 1024>(state.machine(), POLYFLAG_NO_WORK_QUEUE),
+		m_state(state)
+{
+}
+
+void atarisy4_renderer::draw_scanline(INT32 scanline, const extent_t &extent, const atarisy4_polydata &extradata, int threadid)
 {
-	const poly_extra_data *extra = (const poly_extra_data *)extradata;
-	UINT16 color = extra->color;
+	UINT16 color = extradata.color;
 	int x;
 
-	for (x = extent->startx; x < extent->stopx; ++x)
+	for (x = extent.startx; x < extent.stopx; ++x)
 	{
 		UINT32 addr = xy_to_screen_addr(x, scanline);
-		UINT16 pix = extra->screen_ram[addr >> 1];
+		UINT16 pix = extradata.screen_ram[addr >> 1];
 
 		if (x & 1)
 			pix = (pix & (0x00ff)) | color << 8;
 		else
 			pix = (pix & (0xff00)) | color;
 
-		extra->screen_ram[addr >> 1] = pix;
+		extradata.screen_ram[addr >> 1] = pix;
 	}
 }
 
-void atarisy4_state::draw_polygon(UINT16 color)
+void atarisy4_renderer::draw_polygon(UINT16 color)
 {
 	int i;
 	rectangle clip;
-	poly_vertex v1, v2, v3;
-	poly_extra_data *extra = (poly_extra_data *)poly_get_extra_data(m_poly);
+	vertex_t v1, v2, v3;
+	atarisy4_polydata &extradata = object_data_alloc();
+	render_delegate rd_scan = render_delegate(FUNC(atarisy4_renderer::draw_scanline), this);
 
 	clip.set(0, 511, 0, 511);
 
-	extra->color = color;
-	extra->screen_ram = m_screen_ram;
+	extradata.color = color;
+	extradata.screen_ram = m_state.m_screen_ram;
 
 	v1.x = gpu.points[0].x;
 	v1.y = gpu.points[0].y;
@@ -304,7 +322,7 @@ void atarisy4_state::draw_polygon(UINT16 color)
 		v3.x = gpu.points[i].x;
 		v3.y = gpu.points[i].y;
 
-		poly_render_triangle(m_poly, 0, clip, draw_scanline, 1, &v1, &v2, &v3);
+		render_triangle(clip, rd_scan, 0, v1, v2, v3);
 		v2 = v3;
 	}
 }
@@ -452,8 +470,8 @@ void atarisy4_state::execute_gpu_command()
 		}
 		case 0x2c:
 		{
-			draw_polygon(gpu.gr[2]);
-			poly_wait(m_poly, "Normal");
+			m_renderer->draw_polygon(gpu.gr[2]);
+			m_renderer->wait("Normal");
 			break;
 		}
 		default:
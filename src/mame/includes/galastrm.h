@@ -1,5 +1,5 @@
 #include "machine/eepromser.h"
-#include "video/poly.h"
+#include "video/polynew.h"
 #include "video/tc0100scn.h"
 #include "video/tc0480scp.h"
 
@@ -13,6 +13,22 @@ struct tempsprite
 	int primask;
 };
 
+struct galastrm_polydata
+{
+	bitmap_ind16 *texbase;
+	bitmap_ind16 *destmap;
+};
+
+class galastrm_state;
+
+class galastrm_renderer : public poly_manager<float, galastrm_polydata, 2, 16>
+{
+public:
+	galastrm_renderer(galastrm_state &state);
+
+	void tc0610_draw_scanline(INT32 scanline, const extent_t &extent, const galastrm_polydata &extradata, int threadid);
+};
+
 class galastrm_state : public driver_device
 {
 public:
@@ -55,7 +71,7 @@ public:
 	struct tempsprite *m_sprite_ptr_pre;
 	bitmap_ind16 m_tmpbitmaps;
 	bitmap_ind16 m_polybitmap;
-	poly_manager *m_poly;
+	galastrm_renderer *m_poly;
 	int m_rsxb;
 	int m_rsyb;
 	int m_rsxoffs;
@@ -72,7 +88,6 @@ public:
 	virtual void video_start();
 	UINT32 screen_update_galastrm(screen_device &screen, bitmap_ind16 &bitmap, const rectangle &cliprect);
 	INTERRUPT_GEN_MEMBER(galastrm_interrupt);
-	void galastrm_exit();
 	void draw_sprites_pre(int x_offs, int y_offs);
 	void draw_sprites(screen_device &screen, bitmap_ind16 &bitmap, const rectangle &cliprect, const int *primasks, int priority);
 	void tc0610_rotate_draw(bitmap_ind16 &bitmap, bitmap_ind16 &srcbitmap, const rectangle &clip);
@@ -1,4 +1,4 @@
-#include "video/poly.h"
+#include "video/polynew.h"
 #include "audio/dsbz80.h"
 #include "audio/segam1audio.h"
 #include "machine/eepromser.h"
@@ -6,6 +6,46 @@
 
 struct raster_state;
 struct geo_state;
+struct triangle;
+class model2_state;
+
+struct model2_polydata
+{
+	model2_state *  state;
+	bitmap_rgb32 *  destmap;
+	UINT32      lumabase;
+	UINT32      colorbase;
+	UINT32 *    texsheet;
+	UINT32      texwidth;
+	UINT32      texheight;
+	UINT32      texx, texy;
+	UINT8       texmirrorx;
+	UINT8       texmirrory;
+};
+
+class model2_renderer : public poly_manager<float, model2_polydata, 3, 4000>
+{
+public:
+	model2_renderer(model2_state &state);
+
+	void model2_3d_render(bitmap_rgb32 &bitmap, triangle *tri, const rectangle &cliprect);
+
+private:
+	model2_state &m_state;
+	render_delegate m_render_funcs[8];
+
+	void model2_3d_render_0(INT32 scanline, const extent_t &extent, const model2_polydata &object, int threadid);
+	void model2_3d_render_1(INT32 scanline, const extent_t &extent, const model2_polydata &object, int threadid);
+	void model2_3d_render_2(INT32 scanline, const extent_t &extent, const model2_polydata &object, int threadid);
+	void model2_3d_render_3(INT32 scanline, const extent_t &extent, const model2_polydata &object, int threadid);
+	void model2_3d_render_4(INT32 scanline, const extent_t &extent, const model2_polydata &object, int threadid);
+	void model2_3d_render_5(INT32 scanline, const extent_t &extent, const model2_polydata &object, int threadid);
+	void model2_3d_render_6(INT32 scanline, const extent_t &extent, const model2_polydata &object, int threadid);
+	void model2_3d_render_7(INT32 scanline, const extent_t &extent, const model2_polydata &object, int threadid);
+};
+
+// the geometry and clipping code works directly on the renderer's vertices
+typedef model2_renderer::vertex_t poly_vertex;
 
 
 class model2_state : public driver_device
@@ -95,7 +135,7 @@ public:
 	int m_jnet_time_out;
 	UINT32 m_geo_read_start_address;
 	UINT32 m_geo_write_start_address;
-	poly_manager *m_poly;
+	model2_renderer *m_poly;
 	raster_state *m_raster;
 	geo_state *m_geo;
 	bitmap_rgb32 m_sys24_bitmap;
@@ -189,7 +229,6 @@ public:
 	TIMER_DEVICE_CALLBACK_MEMBER(model2_timer_cb);
 	TIMER_DEVICE_CALLBACK_MEMBER(model2_interrupt);
 	TIMER_DEVICE_CALLBACK_MEMBER(model2c_interrupt);
-	void model2_exit();
 	DECLARE_WRITE_LINE_MEMBER(scsp_irq);
 	DECLARE_READ_LINE_MEMBER(copro_tgp_fifoin_pop_ok);
 	DECLARE_READ32_MEMBER(copro_tgp_fifoin_pop);
@@ -1,4 +1,4 @@
-#include "video/poly.h"
+#include "video/polynew.h"
 #include "machine/scsibus.h"
 #include "machine/53c810.h"
 #include "audio/dsbz80.h"
@@ -13,6 +13,37 @@ struct PLANE {
 };
 
 struct cached_texture;
+struct TRIANGLE;
+class model3_state;
+
+struct model3_polydata
+{
+	cached_texture *texture;
+	UINT32 color;
+	UINT8 texture_param;
+	int polygon_transparency;
+	int polygon_intensity;
+};
+
+class model3_renderer : public poly_manager<float, model3_polydata, 3, 4000>
+{
+public:
+	model3_renderer(model3_state &state);
+
+	void render_one(TRIANGLE *tri);
+
+private:
+	model3_state &m_state;
+
+	void draw_scanline_normal(INT32 scanline, const extent_t &extent, const model3_polydata &extra, int threadid);
+	void draw_scanline_trans(INT32 scanline, const extent_t &extent, const model3_polydata &extra, int threadid);
+	void draw_scanline_alpha(INT32 scanline, const extent_t &extent, const model3_polydata &extra, int threadid);
+	void draw_scanline_alpha_test(INT32 scanline, const extent_t &extent, const model3_polydata &extra, int threadid);
+	void draw_scanline_color(INT32 scanline, const extent_t &extent, const model3_polydata &extra, int threadid);
+};
+
+// the clipping code works directly on the renderer's vertices
+typedef model3_renderer::vertex_t poly_vertex;
 
 class model3_state : public driver_device
 {
@@ -101,7 +132,7 @@ public:
 	VECTOR3 m_parallel_light;
 	float m_parallel_light_intensity;
 	float m_ambient_light_intensity;
-	poly_manager *m_poly;
+	model3_renderer *m_poly;
 	int m_list_depth;
 	int m_tick;
 	int m_debug_layer_disable;
@@ -306,7 +306,6 @@ VIDEOS += MC6845
 #VIDEOS += MSM6255
 VIDEOS += PC_CGA
 VIDEOS += PC_VGA
-VIDEOS += POLY
 VIDEOS += PSX
 VIDEOS += RAMDAC
 VIDEOS += SAA5050
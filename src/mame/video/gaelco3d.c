@@ -12,7 +12,6 @@
 #include "includes/gaelco3d.h"
 #include "cpu/tms32031/tms32031.h"
 #include "video/rgbutil.h"
-#include "video/poly.h"
 
 
 #define MAX_POLYGONS        4096
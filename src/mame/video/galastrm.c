@@ -1,15 +1,9 @@
 #include "emu.h"
-#include "video/poly.h"
 #include "includes/galastrm.h"
 
 #define X_OFFSET 96
 #define Y_OFFSET 60
 
-struct poly_extra_data
-{
-	bitmap_ind16 *texbase;
-};
-
 struct polygon
 {
 	float x;
@@ -19,9 +13,9 @@ struct polygon
 
 /******************************************************************/
 
-void galastrm_state::galastrm_exit()
+galastrm_renderer::galastrm_renderer(galastrm_state &state)
+	: poly_manager<float, galastrm_polydata, 2, 16>(state.machine())
 {
-	poly_free(m_poly);
 }
 
 void galastrm_state::video_start()
@@ -31,8 +25,7 @@ void galastrm_state::video_start()
 	m_screen->register_screen_bitmap(m_tmpbitmaps);
 	m_screen->register_screen_bitmap(m_polybitmap);
 
-	m_poly = poly_alloc(machine(), 16, sizeof(poly_extra_data), POLYFLAG_ALLOW_QUADS);
-	machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(FUNC(galastrm_state::galastrm_exit), this));
+	m_poly = auto_alloc(machine(), galastrm_renderer(*this));
 }
 
 /************************************************************
@@ -213,18 +206,16 @@ void galastrm_state::draw_sprites(screen_device &screen, bitmap_ind16 &bitmap, c
                 POLYGON RENDERER
 **************************************************************/
 
-static void tc0610_draw_scanline(void *dest, INT32 scanline, const poly_extent *extent, const void *extradata, int threadid)
+void galastrm_renderer::tc0610_draw_scanline(INT32 scanline, const extent_t &extent, const galastrm_polydata &extradata, int threadid)
 {
-	const poly_extra_data *extra = (const poly_extra_data *)extradata;
-	bitmap_ind16 *destmap = (bitmap_ind16 *)dest;
-	UINT16 *framebuffer = &destmap->pix16(scanline);
-	bitmap_ind16 *texbase = extra->texbase;
-	int startx = extent->startx;
-	int stopx = extent->stopx;
-	INT32 u = extent->param[0].start;
-	INT32 v = extent->param[1].start;
-	INT32 dudx = extent->param[0].dpdx;
-	INT32 dvdx = extent->param[1].dpdx;
+	UINT16 *framebuffer = &extradata.destmap->pix16(scanline);
+	bitmap_ind16 *texbase = extradata.texbase;
+	int startx = extent.startx;
+	int stopx = extent.stopx;
+	INT32 u = extent.param[0].start;
+	INT32 v = extent.param[1].start;
+	INT32 dudx = extent.param[0].dpdx;
+	INT32 dvdx = extent.param[1].dpdx;
 	int x;
 
 	for (x = startx; x < stopx; x++)
@@ -237,9 +228,7 @@ static void tc0610_draw_scanline(void *dest, INT32 scanline, const poly_extent *
 
 void galastrm_state::tc0610_rotate_draw(bitmap_ind16 &bitmap, bitmap_ind16 &srcbitmap, const rectangle &clip)
 {
-	poly_extra_data *extra = (poly_extra_data *)poly_get_extra_data(m_poly);
-	poly_draw_scanline_func callback;
-	poly_vertex vert[4];
+	galastrm_renderer::vertex_t vert[4];
 	int rsx = m_tc0610_ctrl_reg[1][0];
 	int rsy = m_tc0610_ctrl_reg[1][1];
 	const int rzx = m_tc0610_ctrl_reg[1][2];
@@ -417,9 +406,12 @@ void galastrm_state::tc0610_rotate_draw(bitmap_ind16 &bitmap, bitmap_ind16 &srcb
 	vert[3].p[0] = (float)(lx - 1) * 65536.0;
 	vert[3].p[1] = 0.0;
 
-	extra->texbase = &srcbitmap;
-	callback = tc0610_draw_scanline;
-	poly_render_quad(m_poly, &bitmap, clip, callback, 2, &vert[0], &vert[1], &vert[2], &vert[3]);
+	galastrm_polydata &extradata = m_poly->object_data_alloc();
+	extradata.texbase = &srcbitmap;
+	extradata.destmap = &bitmap;
+
+	m_poly->render_polygon<4>(clip, galastrm_renderer::render_delegate(FUNC(galastrm_renderer::tc0610_draw_scanline), m_poly), 2, vert);
+	m_poly->wait("tc0610_rotate_draw");
 }
 
 /**************************************************************
@@ -2,6 +2,7 @@
 
 #include "emu.h"
 #include "k001005.h"
+#include "k001006.h"
 
 
 /*****************************************************************************/
@@ -14,15 +15,14 @@
 /***************************************************************************/
 
 
-struct poly_extra_data
+typedef k001005_renderer::vertex_t poly_vertex;
+
+
+k001005_renderer::k001005_renderer(k001005_device &device)
+	: poly_manager<float, k001005_polydata, 4, 4000>(device.machine()),
+		m_device(device)
 {
-	UINT32 color;
-	int texture_x, texture_y;
-	int texture_page;
-	int texture_palette;
-	int texture_mirror_x;
-	int texture_mirror_y;
-};
+}
 
 
 const device_type K001005 = &device_creator<k001005_device>;
@@ -120,7 +120,7 @@ void k001005_device::device_start()
 
 	m_3d_fifo = auto_alloc_array(machine(), UINT32, 0x10000);
 
-	m_poly = poly_alloc(machine(), 4000, sizeof(poly_extra_data), POLYFLAG_ALLOW_QUADS);
+	m_poly = auto_alloc(machine(), k001005_renderer(*this));
 
 	for (i = 0; i < 128; i++)
 	{
@@ -163,19 +163,15 @@ void k001005_device::device_reset()
 	m_3d_fifo_ptr = 0;
 	m_bitmap_page = 0;
 
-	memset(m_prev_v, 0, sizeof(m_prev_v));
+	for (int i = 0; i < ARRAY_LENGTH(m_prev_v); i++)
+	{
+		m_prev_v[i].x = m_prev_v[i].y = 0;
+		for (int p = 0; p < ARRAY_LENGTH(m_prev_v[i].p); p++)
+			m_prev_v[i].p[p] = 0;
+	}
 	m_prev_poly_type = 0;
 }
 
-//-------------------------------------------------
-//  device_stop - device-specific stop
-//-------------------------------------------------
-
-void k001005_device::device_stop()
-{
-	poly_free(m_poly);
-}
-
 
 static const int decode_x_gti[8] = {  0, 16, 2, 18, 4, 20, 6, 22 };
 static const int decode_y_gti[16] = {  0, 8, 32, 40, 1, 9, 33, 41, 64, 72, 96, 104, 65, 73, 97, 105 };
@@ -377,7 +373,7 @@ WRITE32_MEMBER( k001005_device::write )
 			{
 				swap_buffers();
 				render_polygons();
-				poly_wait(m_poly, "render_polygons");
+				m_poly->wait("render_polygons");
 				m_3d_fifo_ptr = 0;
 			}
 			break;
@@ -409,21 +405,17 @@ WRITE32_MEMBER( k001005_device::write )
 
 }
 
-/* emu/video/poly.c cannot handle atm callbacks passing a device parameter */
-
 #if POLY_DEVICE
-void k001005_device::draw_scanline( void *dest, INT32 scanline, const poly_extent *extent, const void *extradata, int threadid )
+void k001005_renderer::draw_scanline(INT32 scanline, const extent_t &extent, const k001005_polydata &extradata, int threadid)
 {
-	const poly_extra_data *extra = (const poly_extra_data *)extradata;
-	bitmap_ind16 *destmap = (bitmap_ind16 *)dest;
-	float z = extent->param[0].start;
-	float dz = extent->param[0].dpdx;
-	UINT32 *fb = &destmap->pix32(scanline);
-	UINT32 *zb = &m_zbuffer->pix32(scanline);
-	UINT32 color = extra->color;
+	float z = extent.param[0].start;
+	float dz = extent.param[0].dpdx;
+	UINT32 *fb = &extradata.destmap->pix32(scanline);
+	UINT32 *zb = &m_device.m_zbuffer->pix32(scanline);
+	UINT32 color = extradata.color;
 	int x;
 
-	for (x = extent->startx; x < extent->stopx; x++)
+	for (x = extent.startx; x < extent.stopx; x++)
 	{
 		UINT32 iz = (UINT32)z >> 16;
 
@@ -442,32 +434,29 @@ void k001005_device::draw_scanline( void *dest, INT32 scanline, const poly_exten
 #endif
 
 #if POLY_DEVICE
-void k001005_device::draw_scanline_tex( device_t *device, void *dest, INT32 scanline, const poly_extent *extent, const void *extradata, int threadid )
+void k001005_renderer::draw_scanline_tex(INT32 scanline, const extent_t &extent, const k001005_polydata &extradata, int threadid)
 {
-	k001005_state *k001005 = k001005_get_safe_token(device);
-	const poly_extra_data *extra = (const poly_extra_data *)extradata;
-	bitmap_ind16 *destmap = (bitmap_ind16 *)dest;
-	UINT8 *texrom = m_gfxrom + (extra->texture_page * 0x40000);
-	device_t *pal_device = (extra->texture_palette & 0x8) ? m_k001006_2 : m_k001006_1;
-	int palette_index = (extra->texture_palette & 0x7) * 256;
-	float z = extent->param[0].start;
-	float u = extent->param[1].start;
-	float v = extent->param[2].start;
-	float w = extent->param[3].start;
-	float dz = extent->param[0].dpdx;
-	float du = extent->param[1].dpdx;
-	float dv = extent->param[2].dpdx;
-	float dw = extent->param[3].dpdx;
-	int texture_mirror_x = extra->texture_mirror_x;
-	int texture_mirror_y = extra->texture_mirror_y;
-	int texture_x = extra->texture_x;
-	int texture_y = extra->texture_y;
+	UINT8 *texrom = m_device.m_gfxrom + (extradata.texture_page * 0x40000);
+	k001006_device *pal_device = downcast<k001006_device *>((extradata.texture_palette & 0x8) ? m_device.m_k001006_2 : m_device.m_k001006_1);
+	int palette_index = (extradata.texture_palette & 0x7) * 256;
+	float z = extent.param[0].start;
+	float u = extent.param[1].start;
+	float v = extent.param[2].start;
+	float w = extent.param[3].start;
+	float dz = extent.param[0].dpdx;
+	float du = extent.param[1].dpdx;
+	float dv = extent.param[2].dpdx;
+	float dw = extent.param[3].dpdx;
+	int texture_mirror_x = extradata.texture_mirror_x;
+	int texture_mirror_y = extradata.texture_mirror_y;
+	int texture_x = extradata.texture_x;
+	int texture_y = extradata.texture_y;
 	int x;
 
-	UINT32 *fb = &destmap->pix32(scanline);
-	UINT32 *zb = &m_zbuffer->pix32(scanline);
+	UINT32 *fb = &extradata.destmap->pix32(scanline);
+	UINT32 *zb = &m_device.m_zbuffer->pix32(scanline);
 
-	for (x = extent->startx; x < extent->stopx; x++)
+	for (x = extent.startx; x < extent.stopx; x++)
 	{
 		UINT32 iz = (UINT32)z >> 16;
 		//int iu = u >> 16;
@@ -483,10 +472,10 @@ void k001005_device::draw_scanline_tex( device_t *device, void *dest, INT32 scan
 			iu = u * oow;
 			iv = v * oow;
 
-			iiu = texture_x + m_tex_mirror_table[texture_mirror_x][(iu >> 4) & 0x7f];
-			iiv = texture_y + m_tex_mirror_table[texture_mirror_y][(iv >> 4) & 0x7f];
+			iiu = texture_x + m_device.m_tex_mirror_table[texture_mirror_x][(iu >> 4) & 0x7f];
+			iiv = texture_y + m_device.m_tex_mirror_table[texture_mirror_y][(iv >> 4) & 0x7f];
 			texel = texrom[((iiv & 0x1ff) * 512) + (iiu & 0x1ff)];
-			color = k001006_get_palette(pal_device, palette_index + texel);
+			color = pal_device->get_palette(palette_index + texel);
 
 			if (color & 0xff000000)
 			{
@@ -508,7 +497,7 @@ void k001005_device::render_polygons( )
 {
 	int i, j;
 #if POLY_DEVICE
-	const rectangle &visarea = visible_area();
+	const rectangle &visarea = m_screen->visible_area();
 #endif
 
 //  mame_printf_debug("m_fifo_ptr = %08X\n", m_3d_fifo_ptr);
@@ -517,8 +506,10 @@ void k001005_device::render_polygons( )
 	{
 		if (m_3d_fifo[i] == 0x80000003)
 		{
-			poly_extra_data *extra = (poly_extra_data *)poly_get_extra_data(m_poly);
-//          poly_vertex v[4];
+			k001005_polydata &extra = m_poly->object_data_alloc();
+#if POLY_DEVICE
+			poly_vertex v[4];
+#endif
 			int r, g, b, a;
 			UINT32 color;
 			int index = i;
@@ -550,10 +541,11 @@ void k001005_device::render_polygons( )
 			color = (a << 24) | (r << 16) | (g << 8) | (b);
 			++index;
 
-			extra->color = color;
+			extra.destmap = m_bitmap[m_bitmap_page];
+			extra.color = color;
 #if POLY_DEVICE
-			poly_render_triangle(m_poly, m_bitmap[m_bitmap_page], &visarea, draw_scanline, 1, &v[0], &v[1], &v[2]);
-			poly_render_triangle(m_poly, m_bitmap[m_bitmap_page], &visarea, draw_scanline, 1, &v[0], &v[2], &v[3]);
+			m_poly->render_triangle(visarea, k001005_renderer::render_delegate(FUNC(k001005_renderer::draw_scanline), m_poly), 1, v[0], v[1], v[2]);
+			m_poly->render_triangle(visarea, k001005_renderer::render_delegate(FUNC(k001005_renderer::draw_scanline), m_poly), 1, v[0], v[2], v[3]);
 //          poly_render_polygon(m_poly, m_bitmap[m_bitmap_page],  &visarea, draw_scanline, 1, 4, v);
 #endif
 			i = index - 1;
@@ -572,7 +564,7 @@ void k001005_device::render_polygons( )
 			// 0x01: -------- -------- ----x-x- x-x-x-x-    Texture X / 8
 			// 0x01: -------- -------- -----x-x -x-x-x-x    Texture Y / 8
 
-			poly_extra_data *extra = (poly_extra_data *)poly_get_extra_data(m_poly);
+			k001005_polydata &extra = m_poly->object_data_alloc();
 			poly_vertex v[4];
 			int tx, ty;
 			UINT32 color = 0;
@@ -646,23 +638,24 @@ void k001005_device::render_polygons( )
 					((header & 0x008) >> 2) |
 					((header & 0x002) >> 1);
 
-			extra->texture_x = tx * 8;
-			extra->texture_y = ty * 8;
+			extra.texture_x = tx * 8;
+			extra.texture_y = ty * 8;
 
-			extra->texture_page = (header >> 12) & 0x1f;
-			extra->texture_palette = (header >> 28) & 0xf;
+			extra.texture_page = (header >> 12) & 0x1f;
+			extra.texture_palette = (header >> 28) & 0xf;
 
-			extra->texture_mirror_x = ((command & 0x10) ? 0x2 : 0) | ((header & 0x00400000) ? 0x1 : 0);
-			extra->texture_mirror_y = ((command & 0x10) ? 0x2 : 0) | ((header & 0x00400000) ? 0x1 : 0);
+			extra.texture_mirror_x = ((command & 0x10) ? 0x2 : 0) | ((header & 0x00400000) ? 0x1 : 0);
+			extra.texture_mirror_y = ((command & 0x10) ? 0x2 : 0) | ((header & 0x00400000) ? 0x1 : 0);
 
-			extra->color = color;
+			extra.destmap = m_bitmap[m_bitmap_page];
+			extra.color = color;
 
 			if (num_verts < 3)
 			{
 #if POLY_DEVICE
-				poly_render_triangle(m_poly, m_bitmap[m_bitmap_page], &visarea, draw_scanline_tex, 4, &m_prev_v[2], &v[0], &v[1]);
+				m_poly->render_triangle(visarea, k001005_renderer::render_delegate(FUNC(k001005_renderer::draw_scanline_tex), m_poly), 4, m_prev_v[2], v[0], v[1]);
 				if (m_prev_poly_type)
-					poly_render_triangle(m_poly, m_bitmap[m_bitmap_page], &visarea, draw_scanline_tex, 4, &m_prev_v[2], &m_prev_v[3], &v[0]);
+					m_poly->render_triangle(visarea, k001005_renderer::render_delegate(FUNC(k001005_renderer::draw_scanline_tex), m_poly), 4, m_prev_v[2], m_prev_v[3], v[0]);
 //              if (m_prev_poly_type)
 //                  poly_render_quad(m_poly, m_bitmap[m_bitmap_page], &visarea, draw_scanline_tex, 4, &m_prev_v[2], &m_prev_v[3], &v[0], &v[1]);
 //              else
@@ -676,9 +669,9 @@ void k001005_device::render_polygons( )
 			else
 			{
 #if POLY_DEVICE
-				poly_render_triangle(m_poly, m_bitmap[m_bitmap_page], &visarea, draw_scanline_tex, 4, &v[0], &v[1], &v[2]);
+				m_poly->render_triangle(visarea, k001005_renderer::render_delegate(FUNC(k001005_renderer::draw_scanline_tex), m_poly), 4, v[0], v[1], v[2]);
 				if (num_verts > 3)
-					poly_render_triangle(m_poly, m_bitmap[m_bitmap_page], &visarea, draw_scanline_tex, 4, &v[2], &v[3], &v[0]);
+					m_poly->render_triangle(visarea, k001005_renderer::render_delegate(FUNC(k001005_renderer::draw_scanline_tex), m_poly), 4, v[2], v[3], v[0]);
 //              poly_render_polygon(m_poly, m_bitmap[m_bitmap_page], &visarea, draw_scanline_tex, 4, num_verts, v);
 #endif
 				memcpy(m_prev_v, v, sizeof(poly_vertex) * 4);
@@ -688,7 +681,7 @@ void k001005_device::render_polygons( )
 
 			while ((m_3d_fifo[index] & 0xffffff00) != 0x80000000 && index < m_3d_fifo_ptr)
 			{
-				poly_extra_data *extra = (poly_extra_data *)poly_get_extra_data(m_poly);
+				k001005_polydata &extra = m_poly->object_data_alloc();
 #if POLY_DEVICE
 				int new_verts = 0;
 #endif
@@ -752,21 +745,22 @@ void k001005_device::render_polygons( )
 						break;
 				}
 
-				extra->texture_x = tx * 8;
-				extra->texture_y = ty * 8;
+				extra.texture_x = tx * 8;
+				extra.texture_y = ty * 8;
 
-				extra->texture_page = (header >> 12) & 0x1f;
-				extra->texture_palette = (header >> 28) & 0xf;
+				extra.texture_page = (header >> 12) & 0x1f;
+				extra.texture_palette = (header >> 28) & 0xf;
 
-				extra->texture_mirror_x = ((command & 0x10) ? 0x2 : 0) | ((header & 0x00400000) ? 0x1 : 0);
-				extra->texture_mirror_y = ((command & 0x10) ? 0x2 : 0) | ((header & 0x00400000) ? 0x1 : 0);
+				extra.texture_mirror_x = ((command & 0x10) ? 0x2 : 0) | ((header & 0x00400000) ? 0x1 : 0);
+				extra.texture_mirror_y = ((command & 0x10) ? 0x2 : 0) | ((header & 0x00400000) ? 0x1 : 0);
 
-				extra->color = color;
+				extra.destmap = m_bitmap[m_bitmap_page];
+				extra.color = color;
 
 #if POLY_DEVICE
-				poly_render_triangle(m_poly, m_bitmap[m_bitmap_page], &visarea, draw_scanline_tex, 4, &v[0], &v[1], &v[2]);
+				m_poly->render_triangle(visarea, k001005_renderer::render_delegate(FUNC(k001005_renderer::draw_scanline_tex), m_poly), 4, v[0], v[1], v[2]);
 				if (new_verts > 1)
-					poly_render_triangle(m_poly, m_bitmap[m_bitmap_page], &visarea, draw_scanline_tex, 4, &v[2], &v[3], &v[0]);
+					m_poly->render_triangle(visarea, k001005_renderer::render_delegate(FUNC(k001005_renderer::draw_scanline_tex), m_poly), 4, v[2], v[3], v[0]);
 //              poly_render_polygon(m_poly, m_bitmap[m_bitmap_page], &visarea, draw_scanline_tex, 4, new_verts + 2, v);
 #endif
 				memcpy(m_prev_v, v, sizeof(poly_vertex) * 4);
@@ -777,7 +771,7 @@ void k001005_device::render_polygons( )
 		else if (m_3d_fifo[i] == 0x80000006 || m_3d_fifo[i] == 0x80000026 ||
 					m_3d_fifo[i] == 0x80000020 || m_3d_fifo[i] == 0x80000022)
 		{
-			poly_extra_data *extra = (poly_extra_data *)poly_get_extra_data(m_poly);
+			k001005_polydata &extra = m_poly->object_data_alloc();
 			poly_vertex v[4];
 			int r, g, b, a;
 			UINT32 color;
@@ -821,19 +815,20 @@ void k001005_device::render_polygons( )
 			color = (a << 24) | (r << 16) | (g << 8) | (b);
 			index++;
 
-			extra->color = color;
+			extra.destmap = m_bitmap[m_bitmap_page];
+			extra.color = color;
 
 #if POLY_DEVICE
-			poly_render_triangle(m_poly, m_bitmap[m_bitmap_page], &visarea, draw_scanline, 1, &v[0], &v[1], &v[2]);
+			m_poly->render_triangle(visarea, k001005_renderer::render_delegate(FUNC(k001005_renderer::draw_scanline), m_poly), 1, v[0], v[1], v[2]);
 			if (num_verts > 3)
-				poly_render_triangle(m_poly, m_bitmap[m_bitmap_page], &visarea, draw_scanline, 1, &v[2], &v[3], &v[0]);
+				m_poly->render_triangle(visarea, k001005_renderer::render_delegate(FUNC(k001005_renderer::draw_scanline), m_poly), 1, v[2], v[3], v[0]);
 //          poly_render_polygon(m_poly, m_bitmap[m_bitmap_page], &visarea, draw_scanline, 1, num_verts, v);
 #endif
 			memcpy(m_prev_v, v, sizeof(poly_vertex) * 4);
 
 			while ((m_3d_fifo[index] & 0xffffff00) != 0x80000000 && index < m_3d_fifo_ptr)
 			{
-				poly_extra_data *extra = (poly_extra_data *)poly_get_extra_data(m_poly);
+				k001005_polydata &extra = m_poly->object_data_alloc();
 				int new_verts = 0;
 
 				if (poly_type)
@@ -881,12 +876,13 @@ void k001005_device::render_polygons( )
 				color = (a << 24) | (r << 16) | (g << 8) | (b);
 				index++;
 
-				extra->color = color;
+				extra.destmap = m_bitmap[m_bitmap_page];
+				extra.color = color;
 
 #if POLY_DEVICE
-				poly_render_triangle(m_poly, m_bitmap[m_bitmap_page], &visarea, draw_scanline, 1, &v[0], &v[1], &v[2]);
+				m_poly->render_triangle(visarea, k001005_renderer::render_delegate(FUNC(k001005_renderer::draw_scanline), m_poly), 1, v[0], v[1], v[2]);
 				if (new_verts > 1)
-					poly_render_triangle(m_poly, m_bitmap[m_bitmap_page], &visarea, draw_scanline, 1, &v[0], &v[2], &v[3]);
+					m_poly->render_triangle(visarea, k001005_renderer::render_delegate(FUNC(k001005_renderer::draw_scanline), m_poly), 1, v[0], v[2], v[3]);
 //              poly_render_polygon(m_poly, m_bitmap[m_bitmap_page], &visarea, draw_scanline, 1, new_verts + 2, v);
 #endif
 				memcpy(m_prev_v, v, sizeof(poly_vertex) * 4);
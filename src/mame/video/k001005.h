@@ -2,11 +2,38 @@
 #ifndef __K001005_H__
 #define __K001005_H__
 
-#include "video/poly.h"
+#include "video/polynew.h"
 #include "cpu/sharc/sharc.h"
 
 #define POLY_DEVICE 0
 
+struct k001005_polydata
+{
+	bitmap_rgb32 *destmap;
+	UINT32 color;
+	int texture_x, texture_y;
+	int texture_page;
+	int texture_palette;
+	int texture_mirror_x;
+	int texture_mirror_y;
+};
+
+class k001005_device;
+
+class k001005_renderer : public poly_manager<float, k001005_polydata, 4, 4000>
+{
+public:
+	k001005_renderer(k001005_device &device);
+
+#if POLY_DEVICE
+	void draw_scanline(INT32 scanline, const extent_t &extent, const k001005_polydata &extradata, int threadid);
+	void draw_scanline_tex(INT32 scanline, const extent_t &extent, const k001005_polydata &extradata, int threadid);
+#endif
+
+private:
+	k001005_device &m_device;
+};
+
 struct k001005_interface
 {
 	const char     *m_cpu_tag;
@@ -34,14 +61,6 @@ public:
 	void preprocess_texture_data(UINT8 *rom, int length, int gticlub);
 	void render_polygons();
 
-	#if POLY_DEVICE
-
-	void draw_scanline( void *dest, INT32 scanline, const poly_extent *extent, const void *extradata, int threadid );
-	void draw_scanline_tex( void *dest, INT32 scanline, const poly_extent *extent, const void *extradata, int threadid );
-
-
-	#endif
-
 	DECLARE_READ32_MEMBER( read );
 	DECLARE_WRITE32_MEMBER( write );
 
@@ -49,10 +68,11 @@ protected:
 	// device-level overrides
 	virtual void device_config_complete();
 	virtual void device_start();
-	virtual void device_stop();
 	virtual void device_reset();
 
 private:
+	friend class k001005_renderer;
+
 	// internal state
 	device_t *m_cpu;
 	adsp21062_device *m_dsp;
@@ -77,8 +97,8 @@ private:
 
 	int m_bitmap_page;
 
-	poly_manager *m_poly;
-	poly_vertex m_prev_v[4];
+	k001005_renderer *m_poly;
+	k001005_renderer::vertex_t m_prev_v[4];
 	int m_prev_poly_type;
 
 	UINT8 *m_gfxrom;
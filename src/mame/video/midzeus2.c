@@ -9,7 +9,7 @@
 #include "emu.h"
 #include "cpu/tms32031/tms32031.h"
 #include "includes/midzeus.h"
-#include "video/poly.h"
+#include "video/polynew.h"
 #include "video/rgbutil.h"
 
 
@@ -37,7 +37,7 @@
  *
  *************************************/
 
-struct poly_extra_data
+struct midzeus2_polydata
 {
 	const void *    palbase;
 	const void *    texbase;
@@ -49,6 +49,19 @@ struct poly_extra_data
 	UINT32          alpha;
 };
 
+class midzeus2_renderer : public poly_manager<float, midzeus2_polydata, 4, 10000>
+{
+public:
+	midzeus2_renderer(running_machine &machine)
+		: poly_manager<float, midzeus2_polydata, 4, 10000>(machine) { }
+
+	void render_quad_fan(const rectangle &cliprect, render_delegate callback, int paramcount, int numverts, const vertex_t *v);
+
+	void render_poly_8bit(INT32 scanline, const extent_t &extent, const midzeus2_polydata &extra, int threadid);
+};
+
+typedef midzeus2_renderer::vertex_t poly_vertex;
+
 
 
 /*************************************
@@ -57,7 +70,7 @@ struct poly_extra_data
  *
  *************************************/
 
-static poly_manager *poly;
+static midzeus2_renderer *poly;
 static UINT8 log_fifo;
 
 static UINT32 zeus_fifo[20];
@@ -109,7 +122,6 @@ static void zeus_pointer_write(UINT8 which, UINT32 value);
 static int zeus_fifo_process(running_machine &machine, const UINT32 *data, int numwords);
 static void zeus_draw_model(running_machine &machine, UINT32 baseaddr, UINT16 count, int logit);
 static void zeus_draw_quad(running_machine &machine, const UINT32 *databuffer, UINT32 texoffs, int logit);
-static void render_poly_8bit(void *dest, INT32 scanline, const poly_extent *extent, const void *extradata, int threadid);
 
 static void log_fifo_command(const UINT32 *data, int numwords, const char *suffix);
 //static void log_waveram(UINT32 base, UINT16 length);
@@ -269,7 +281,7 @@ VIDEO_START_MEMBER(midzeus_state,midzeus2)
 	waveram[1] = auto_alloc_array(machine(), UINT32, WAVERAM1_WIDTH * WAVERAM1_HEIGHT * 12/4);
 
 	/* initialize polygon engine */
-	poly = poly_alloc(machine(), 10000, sizeof(poly_extra_data), POLYFLAG_ALLOW_QUADS);
+	poly = auto_alloc(machine(), midzeus2_renderer(machine()));
 
 	/* we need to cleanup on exit */
 	machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(FUNC(midzeus_state::exit_handler2), this));
@@ -345,8 +357,6 @@ void midzeus_state::exit_handler2()
 		}
 }
 #endif
-
-	poly_free(poly);
 }
 
 
@@ -361,7 +371,7 @@ UINT32 midzeus_state::screen_update_midzeus2(screen_device &screen, bitmap_rgb32
 {
 	int x, y;
 
-	poly_wait(poly, "VIDEO_UPDATE");
+	poly->wait("VIDEO_UPDATE");
 
 if (machine().input().code_pressed(KEYCODE_UP)) { zbase += 1.0f; popmessage("Zbase = %f", zbase); }
 if (machine().input().code_pressed(KEYCODE_DOWN)) { zbase -= 1.0f; popmessage("Zbase = %f", zbase); }
@@ -1041,8 +1051,7 @@ static void zeus_draw_model(running_machine &machine, UINT32 baseaddr, UINT16 co
 static void zeus_draw_quad(running_machine &machine, const UINT32 *databuffer, UINT32 texoffs, int logit)
 {
 	midzeus_state *state = machine.driver_data<midzeus_state>();
-	poly_draw_scanline_func callback;
-	poly_extra_data *extra;
+	midzeus2_renderer::render_delegate callback;
 	poly_vertex clipvert[8];
 	poly_vertex vert[4];
 //  float uscale, vscale;
@@ -1067,7 +1076,7 @@ if (machine.input().code_pressed(KEYCODE_Y) && (texoffs & 0xffff) == 0x0dd) retu
 //if (machine.input().code_pressed(KEYCODE_O) && (texoffs & 0xffff) == 0x119) return;
 //if (machine.input().code_pressed(KEYCODE_L) && (texoffs & 0x100)) return;
 
-	callback = render_poly_8bit;
+	callback = midzeus2_renderer::render_delegate(FUNC(midzeus2_renderer::render_poly_8bit), poly);
 
 /*
 0   38800000
@@ -1182,7 +1191,7 @@ In memory:
 		}
 	}
 
-	numverts = poly_zclip_if_less(4, &vert[0], &clipvert[0], 4, 1.0f / 512.0f / 4.0f);
+	numverts = poly->zclip_if_less(4, &vert[0], &clipvert[0], 4, 1.0f / 512.0f / 4.0f);
 	if (numverts < 3)
 		return;
 
@@ -1213,7 +1222,7 @@ In memory:
 			clipvert[i].y += 0.0005f;
 	}
 
-	extra = (poly_extra_data *)poly_get_extra_data(poly);
+	midzeus2_polydata &extra = poly->object_data_alloc();
 	switch (texmode)
 	{
 		case 0x01d:     /* crusnexo: RHS of score bar */
@@ -1225,19 +1234,19 @@ In memory:
 		case 0x95d:     /* crusnexo */
 		case 0xc1d:     /* crusnexo */
 		case 0xc5d:     /* crusnexo */
-			extra->texwidth = 256;
+			extra.texwidth = 256;
 			break;
 
 		case 0x059:     /* crusnexo */
 		case 0x0d9:     /* crusnexo */
 		case 0x119:     /* crusnexo: license plates */
 		case 0x159:     /* crusnexo */
-			extra->texwidth = 128;
+			extra.texwidth = 128;
 			break;
 
 		case 0x055:     /* crusnexo */
 		case 0x155:     /* crusnexo */
-			extra->texwidth = 64;
+			extra.texwidth = 64;
 			break;
 
 		default:
@@ -1252,14 +1261,14 @@ In memory:
 		}
 	}
 
-	extra->solidcolor = 0;//state->m_zeusbase[0x00] & 0x7fff;
-	extra->zoffset = 0;//state->m_zeusbase[0x7e] >> 16;
-	extra->alpha = 0;//state->m_zeusbase[0x4e];
-	extra->transcolor = 0x100;//((databuffer[1] >> 16) & 1) ? 0 : 0x100;
-	extra->texbase = WAVERAM_BLOCK0(zeus_texbase);
-	extra->palbase = waveram0_ptr_from_expanded_addr(state->m_zeusbase[0x41]);
+	extra.solidcolor = 0;//state->m_zeusbase[0x00] & 0x7fff;
+	extra.zoffset = 0;//state->m_zeusbase[0x7e] >> 16;
+	extra.alpha = 0;//state->m_zeusbase[0x4e];
+	extra.transcolor = 0x100;//((databuffer[1] >> 16) & 1) ? 0 : 0x100;
+	extra.texbase = WAVERAM_BLOCK0(zeus_texbase);
+	extra.palbase = waveram0_ptr_from_expanded_addr(state->m_zeusbase[0x41]);
 
-	poly_render_quad_fan(poly, NULL, zeus_cliprect, callback, 4, numverts, &clipvert[0]);
+	poly->render_quad_fan(zeus_cliprect, callback, 4, numverts, &clipvert[0]);
 }
 
 
@@ -1270,27 +1279,42 @@ In memory:
  *
  *************************************/
 
-static void render_poly_8bit(void *dest, INT32 scanline, const poly_extent *extent, const void *extradata, int threadid)
+void midzeus2_renderer::render_quad_fan(const rectangle &cliprect, render_delegate callback, int paramcount, int numverts, const vertex_t *v)
+{
+	vertex_t quad[4];
+	int vertnum;
+
+	/* fan out quads around the first vertex; an odd vertex count ends in a degenerate quad */
+	quad[0] = v[0];
+	for (vertnum = 2; vertnum < numverts; vertnum += 2)
+	{
+		quad[1] = v[vertnum - 1];
+		quad[2] = v[vertnum];
+		quad[3] = v[MIN(vertnum + 1, numverts - 1)];
+		render_polygon<4>(cliprect, callback, paramcount, quad);
+	}
+}
+
+void midzeus2_renderer::render_poly_8bit(INT32 scanline, const extent_t &extent, const midzeus2_polydata &extra, int threadid)
 {
-	const poly_extra_data *extra = (const poly_extra_data *)extradata;
-	INT32 curz = extent->param[0].start;
-	INT32 curu = extent->param[1].start;
-	INT32 curv = extent->param[2].start;
-//  INT32 curi = extent->param[3].start;
-	INT32 dzdx = extent->param[0].dpdx;
-	INT32 dudx = extent->param[1].dpdx;
-	INT32 dvdx = extent->param[2].dpdx;
-//  INT32 didx = extent->param[3].dpdx;
-	const void *texbase = extra->texbase;
-	const void *palbase = extra->palbase;
-	UINT16 transcolor = extra->transcolor;
-	int texwidth = extra->texwidth;
+	INT32 curz = extent.param[0].start;
+	INT32 curu = extent.param[1].start;
+	INT32 curv = extent.param[2].start;
+//  INT32 curi = extent.param[3].start;
+	INT32 dzdx = extent.param[0].dpdx;
+	INT32 dudx = extent.param[1].dpdx;
+	INT32 dvdx = extent.param[2].dpdx;
+//  INT32 didx = extent.param[3].dpdx;
+	const void *texbase = extra.texbase;
+	const void *palbase = extra.palbase;
+	UINT16 transcolor = extra.transcolor;
+	int texwidth = extra.texwidth;
 	int x;
 
-	for (x = extent->startx; x < extent->stopx; x++)
+	for (x = extent.startx; x < extent.stopx; x++)
 	{
 		UINT16 *depthptr = WAVERAM_PTRDEPTH(zeus_renderbase, scanline, x);
-		INT32 depth = (curz >> 16) + extra->zoffset;
+		INT32 depth = (curz >> 16) + extra.zoffset;
 		if (depth > 0x7fff) depth = 0x7fff;
 		if (depth >= 0 && depth <= *depthptr)
 		{
@@ -87,7 +87,6 @@
 *********************************************************************************************************************************/
 #include "emu.h"
 #include "video/segaic24.h"
-#include "video/poly.h"
 #include "includes/model2.h"
 
 #define MODEL2_VIDEO_DEBUG 0
@@ -137,20 +136,6 @@ struct quad_m2
 	UINT8               luma;
 };
 
-struct poly_extra_data
-{
-	model2_state *  state;
-	UINT32      lumabase;
-	UINT32      colorbase;
-	UINT32 *    texsheet;
-	UINT32      texwidth;
-	UINT32      texheight;
-	UINT32      texx, texy;
-	UINT8       texmirrorx;
-	UINT8       texmirrory;
-};
-
-
 /*******************************************
  *
  *  Generic 3D Math Functions
@@ -910,22 +895,23 @@ INLINE UINT16 get_texel( UINT32 base_x, UINT32 base_y, int x, int y, UINT32 *she
 
 /***********************************************************************************************/
 
-static const poly_draw_scanline_func render_funcs[8] =
+model2_renderer::model2_renderer(model2_state &state)
+	: poly_manager<float, model2_polydata, 3, 4000>(state.machine()),
+		m_state(state)
 {
-	model2_3d_render_0, /* checker = 0, textured = 0, translucent = 0 */
-	model2_3d_render_1, /* checker = 0, textured = 0, translucent = 1 */
-	model2_3d_render_2, /* checker = 0, textured = 1, translucent = 0 */
-	model2_3d_render_3, /* checker = 0, textured = 1, translucent = 1 */
-	model2_3d_render_4, /* checker = 1, textured = 0, translucent = 0 */
-	model2_3d_render_5, /* checker = 1, textured = 0, translucent = 1 */
-	model2_3d_render_6, /* checker = 1, textured = 1, translucent = 0 */
-	model2_3d_render_7  /* checker = 1, textured = 1, translucent = 1 */
-};
+	m_render_funcs[0] = render_delegate(FUNC(model2_renderer::model2_3d_render_0), this); /* checker = 0, textured = 0, translucent = 0 */
+	m_render_funcs[1] = render_delegate(FUNC(model2_renderer::model2_3d_render_1), this); /* checker = 0, textured = 0, translucent = 1 */
+	m_render_funcs[2] = render_delegate(FUNC(model2_renderer::model2_3d_render_2), this); /* checker = 0, textured = 1, translucent = 0 */
+	m_render_funcs[3] = render_delegate(FUNC(model2_renderer::model2_3d_render_3), this); /* checker = 0, textured = 1, translucent = 1 */
+	m_render_funcs[4] = render_delegate(FUNC(model2_renderer::model2_3d_render_4), this); /* checker = 1, textured = 0, translucent = 0 */
+	m_render_funcs[5] = render_delegate(FUNC(model2_renderer::model2_3d_render_5), this); /* checker = 1, textured = 0, translucent = 1 */
+	m_render_funcs[6] = render_delegate(FUNC(model2_renderer::model2_3d_render_6), this); /* checker = 1, textured = 1, translucent = 0 */
+	m_render_funcs[7] = render_delegate(FUNC(model2_renderer::model2_3d_render_7), this); /* checker = 1, textured = 1, translucent = 1 */
+}
 
-static void model2_3d_render( model2_state *state, bitmap_rgb32 &bitmap, triangle *tri, const rectangle &cliprect )
+void model2_renderer::model2_3d_render( bitmap_rgb32 &bitmap, triangle *tri, const rectangle &cliprect )
 {
-	poly_manager *poly = state->m_poly;
-	poly_extra_data *extra = (poly_extra_data *)poly_get_extra_data(poly);
+	model2_polydata &extra = object_data_alloc();
 	UINT8       renderer;
 
 	/* select renderer based on attributes (bit15 = checker, bit14 = textured, bit13 = transparent */
@@ -935,19 +921,20 @@ static void model2_3d_render( model2_state *state, bitmap_rgb32 &bitmap, triangl
 	rectangle vp(tri->viewport[0] - 8, tri->viewport[2] - 8, (384-tri->viewport[3])+90, (384-tri->viewport[1])+90);
 	vp &= cliprect;
 
-	extra->state = state;
-	extra->lumabase = ((tri->texheader[1] & 0xFF) << 7) + ((tri->luma >> 5) ^ 0x7);
-	extra->colorbase = (tri->texheader[3] >> 6) & 0x3FF;
+	extra.state = &m_state;
+	extra.destmap = &bitmap;
+	extra.lumabase = ((tri->texheader[1] & 0xFF) << 7) + ((tri->luma >> 5) ^ 0x7);
+	extra.colorbase = (tri->texheader[3] >> 6) & 0x3FF;
 
 	if (renderer & 2)
 	{
-		extra->texwidth = 32 << ((tri->texheader[0] >> 0) & 0x7);
-		extra->texheight = 32 << ((tri->texheader[0] >> 3) & 0x7);
-		extra->texx = 32 * ((tri->texheader[2] >> 0) & 0x1f);
-		extra->texy = 32 * (((tri->texheader[2] >> 6) & 0x1f) + ( tri->texheader[2] & 0x20 ));
-		extra->texmirrorx = (tri->texheader[0] >> 9) & 1;
-		extra->texmirrory = (tri->texheader[0] >> 8) & 1;
-		extra->texsheet = (tri->texheader[2] & 0x1000) ? state->m_textureram1 : state->m_textureram0;
+		extra.texwidth = 32 << ((tri->texheader[0] >> 0) & 0x7);
+		extra.texheight = 32 << ((tri->texheader[0] >> 3) & 0x7);
+		extra.texx = 32 * ((tri->texheader[2] >> 0) & 0x1f);
+		extra.texy = 32 * (((tri->texheader[2] >> 6) & 0x1f) + ( tri->texheader[2] & 0x20 ));
+		extra.texmirrorx = (tri->texheader[0] >> 9) & 1;
+		extra.texmirrory = (tri->texheader[0] >> 8) & 1;
+		extra.texsheet = (tri->texheader[2] & 0x1000) ? m_state.m_textureram1 : m_state.m_textureram0;
 
 		tri->v[0].pz = 1.0f / (1.0f + tri->v[0].pz);
 		tri->v[0].pu = tri->v[0].pu * tri->v[0].pz * (1.0f / 8.0f);
@@ -959,10 +946,10 @@ static void model2_3d_render( model2_state *state, bitmap_rgb32 &bitmap, triangl
 		tri->v[2].pu = tri->v[2].pu * tri->v[2].pz * (1.0f / 8.0f);
 		tri->v[2].pv = tri->v[2].pv * tri->v[2].pz * (1.0f / 8.0f);
 
-		poly_render_triangle(poly, &bitmap, vp, render_funcs[renderer], 3, &tri->v[0], &tri->v[1], &tri->v[2]);
+		render_triangle(vp, m_render_funcs[renderer], 3, tri->v[0], tri->v[1], tri->v[2]);
 	}
 	else
-		poly_render_triangle(poly, &bitmap, vp, render_funcs[renderer], 0, &tri->v[0], &tri->v[1], &tri->v[2]);
+		render_triangle(vp, m_render_funcs[renderer], 0, tri->v[0], tri->v[1], tri->v[2]);
 }
 
 /*
@@ -1074,13 +1061,13 @@ static void model2_3d_frame_end( model2_state *state, bitmap_rgb32 &bitmap, cons
 			{
 				/* project and render */
 				model2_3d_project( tri );
-				model2_3d_render( state, bitmap, tri, cliprect );
+				state->m_poly->model2_3d_render( bitmap, tri, cliprect );
 
 				tri = (triangle *)tri->next;
 			}
 		}
 	}
-	poly_wait(state->m_poly, "End of frame");
+	state->m_poly->wait("End of frame");
 }
 
 /* 3D Rasterizer main data input port */
@@ -2692,11 +2679,6 @@ static void geo_parse( model2_state *state )
 /***********************************************************************************************/
 
 
-void model2_state::model2_exit()
-{
-	poly_free(m_poly);
-}
-
 VIDEO_START_MEMBER(model2_state,model2)
 {
 	const rectangle &visarea = m_screen->visible_area();
@@ -2705,8 +2687,7 @@ VIDEO_START_MEMBER(model2_state,model2)
 
 	m_sys24_bitmap.allocate(width, height+4);
 
-	m_poly = poly_alloc(machine(), 4000, sizeof(poly_extra_data), 0);
-	machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(FUNC(model2_state::model2_exit), this));
+	m_poly = auto_alloc(machine(), model2_renderer(*this));
 
 	/* initialize the hardware rasterizer */
 	model2_3d_init( machine(), (UINT16*)memregion("user3")->base() );
@@ -1,5 +1,4 @@
 #include "emu.h"
-#include "video/poly.h"
 #include "video/rgbutil.h"
 #include "includes/model3.h"
 
@@ -33,16 +32,6 @@ struct cached_texture
 	rgb_t       data[1];
 };
 
-struct poly_extra_data
-{
-	cached_texture *texture;
-	bitmap_ind32 *zbuffer;
-	UINT32 color;
-	UINT8 texture_param;
-	int polygon_transparency;
-	int polygon_intensity;
-};
-
 #define TRI_PARAM_TEXTURE_PAGE          0x1
 #define TRI_PARAM_TEXTURE_MIRROR_U      0x2
 #define TRI_PARAM_TEXTURE_MIRROR_V      0x4
@@ -107,14 +96,15 @@ static const int num_bits[16] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4
 
 void model3_state::model3_exit()
 {
+	// the textures may still be in use by queued polygons
+	m_poly->wait("exit");
 	invalidate_texture(machine(), 0, 0, 0, 6, 5);
 	invalidate_texture(machine(), 1, 0, 0, 6, 5);
-	poly_free(m_poly);
 }
 
 void model3_state::video_start()
 {
-	m_poly = poly_alloc(machine(), 4000, sizeof(poly_extra_data), 0);
+	m_poly = auto_alloc(machine(), model3_renderer(*this));
 	machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(FUNC(model3_state::model3_exit), this));
 
 	m_screen->register_screen_bitmap(m_bitmap3d);
@@ -1038,17 +1028,21 @@ static int clip_polygon(const poly_vertex *v, int num_vertices, PLANE cp, poly_v
 	return clip_verts;
 }
 
-static void render_one(running_machine &machine, TRIANGLE *tri)
+model3_renderer::model3_renderer(model3_state &state)
+	: poly_manager<float, model3_polydata, 3, 4000>(state.machine()),
+		m_state(state)
 {
-	model3_state *state = machine.driver_data<model3_state>();
-	poly_extra_data *extra = (poly_extra_data *)poly_get_extra_data(state->m_poly);
-	poly_draw_scanline_func callback = NULL;
+}
+
+void model3_renderer::render_one(TRIANGLE *tri)
+{
+	model3_polydata &extra = object_data_alloc();
+	render_delegate callback;
 
 	tri->v[0].pz = 1.0f / tri->v[0].pz;
 	tri->v[1].pz = 1.0f / tri->v[1].pz;
 	tri->v[2].pz = 1.0f / tri->v[2].pz;
 
-	extra->zbuffer = &state->m_zbuffer;
 	if (tri->param & TRI_PARAM_TEXTURE_ENABLE)
 	{
 		tri->v[0].pu = tri->v[0].pu * tri->v[0].pz * 256.0f;
@@ -1058,26 +1052,26 @@ static void render_one(running_machine &machine, TRIANGLE *tri)
 		tri->v[2].pu = tri->v[2].pu * tri->v[2].pz * 256.0f;
 		tri->v[2].pv = tri->v[2].pv * tri->v[2].pz * 256.0f;
 
-		extra->texture = get_texture(machine, (tri->param & TRI_PARAM_TEXTURE_PAGE) ? 1 : 0, tri->texture_x, tri->texture_y, tri->texture_width, tri->texture_height, tri->texture_format);
-		extra->texture_param        = tri->param;
-		extra->polygon_transparency = tri->transparency;
-		extra->polygon_intensity    = tri->intensity;
+		extra.texture = get_texture(machine(), (tri->param & TRI_PARAM_TEXTURE_PAGE) ? 1 : 0, tri->texture_x, tri->texture_y, tri->texture_width, tri->texture_height, tri->texture_format);
+		extra.texture_param        = tri->param;
+		extra.polygon_transparency = tri->transparency;
+		extra.polygon_intensity    = tri->intensity;
 
 		if (tri->param & TRI_PARAM_ALPHA_TEST)
-			callback = draw_scanline_alpha_test;
-		else if (extra->texture->alpha == 0xff)
-			callback = (tri->transparency >= 32) ? draw_scanline_normal : draw_scanline_trans;
+			callback = render_delegate(FUNC(model3_renderer::draw_scanline_alpha_test), this);
+		else if (extra.texture->alpha == 0xff)
+			callback = (tri->transparency >= 32) ? render_delegate(FUNC(model3_renderer::draw_scanline_normal), this) : render_delegate(FUNC(model3_renderer::draw_scanline_trans), this);
 		else
-			callback = draw_scanline_alpha;
-		poly_render_triangle(state->m_poly, &state->m_bitmap3d, state->m_clip3d, callback, 3, &tri->v[0], &tri->v[1], &tri->v[2]);
+			callback = render_delegate(FUNC(model3_renderer::draw_scanline_alpha), this);
+		render_triangle(m_state.m_clip3d, callback, 3, tri->v[0], tri->v[1], tri->v[2]);
 	}
 	else
 	{
-		extra->polygon_transparency = tri->transparency;
-		extra->polygon_intensity    = tri->intensity;
-		extra->color                = tri->color;
+		extra.polygon_transparency = tri->transparency;
+		extra.polygon_intensity    = tri->intensity;
+		extra.color                = tri->color;
 
-		poly_render_triangle(state->m_poly, &state->m_bitmap3d, state->m_clip3d, draw_scanline_color, 1, &tri->v[0], &tri->v[1], &tri->v[2]);
+		render_triangle(m_state.m_clip3d, render_delegate(FUNC(model3_renderer::draw_scanline_color), this), 1, tri->v[0], tri->v[1], tri->v[2]);
 	}
 }
 
@@ -1110,7 +1104,12 @@ static void draw_model(running_machine &machine, UINT32 addr)
 	center_x = (float)(state->m_viewport_region_x + (state->m_viewport_region_width / 2));
 	center_y = (float)(state->m_viewport_region_y + (state->m_viewport_region_height / 2));
 
-	memset(prev_vertex, 0, sizeof(prev_vertex));
+	for (int i = 0; i < ARRAY_LENGTH(prev_vertex); i++)
+	{
+		prev_vertex[i].x = prev_vertex[i].y = 0;
+		for (int p = 0; p < ARRAY_LENGTH(prev_vertex[i].p); p++)
+			prev_vertex[i].p[p] = 0;
+	}
 
 	while (!last_polygon)
 	{
@@ -1317,7 +1316,7 @@ static void draw_model(running_machine &machine, UINT32 addr)
 				tri.param   |= (header[2] & 0x1) ? TRI_PARAM_TEXTURE_MIRROR_V : 0;
 				tri.param   |= (header[6] & 0x80000000) ? TRI_PARAM_ALPHA_TEST : 0;
 
-				render_one(machine, &tri);
+				state->m_poly->render_one(&tri);
 			}
 		}
 	}
@@ -1543,5 +1542,5 @@ static void real3d_traverse_display_list(running_machine &machine)
 	for (pri = 0; pri < 4; pri++)
 		draw_viewport(machine, pri, 0x800000);
 
-	poly_wait(state->m_poly, "real3d_traverse_display_list");
+	state->m_poly->wait("real3d_traverse_display_list");
 }
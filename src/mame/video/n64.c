@@ -407,30 +407,6 @@ void n64_rdp::TCDiv(INT32 ss, INT32 st, INT32 sw, INT32* sss, INT32* sst)
 	*sst = (*sst & 0x1ffff) | (over_t << 18) | (under_t << 17);
 }
 
-INT32 n64_rdp::ColorCombinerEquation(INT32 a, INT32 b, INT32 c, INT32 d)
-{
-	a = KURT_AKELEY_SIGN9(a);
-	b = KURT_AKELEY_SIGN9(b);
-	c = SIGN9(c);
-	d = KURT_AKELEY_SIGN9(d);
-	a = (((a - b) * c) + (d << 8) + 0x80);
-	a = SIGN17(a) >> 8;
-	a = s_special_9bit_clamptable[a & 0x1ff];
-	return a;
-}
-
-INT32 n64_rdp::AlphaCombinerEquation(INT32 a, INT32 b, INT32 c, INT32 d)
-{
-	a = KURT_AKELEY_SIGN9(a);
-	b = KURT_AKELEY_SIGN9(b);
-	c = SIGN9(c);
-	d = KURT_AKELEY_SIGN9(d);
-	a = (((a - b) * c) + (d << 8) + 0x80) >> 8;
-	a = SIGN9(a);
-	a = s_special_9bit_clamptable[a & 0x1ff];
-	return a;
-}
-
 void n64_rdp::SetSubAInputRGB(UINT8 **input_r, UINT8 **input_g, UINT8 **input_b, int code, rdp_span_aux *userdata)
 {
 	switch (code & 0xf)
@@ -455,9 +455,30 @@ class n64_rdp : public poly_manager<UINT32, rdp_poly_state, 8, 32000>
 		// Internal state
 		CombineModesT*  GetCombine() { return &m_combine; }
 
-		// Color Combiner
-		INT32       ColorCombinerEquation(INT32 a, INT32 b, INT32 c, INT32 d);
-		INT32       AlphaCombinerEquation(INT32 a, INT32 b, INT32 c, INT32 d);
+		// Color Combiner; the equations are defined here so the span drawers
+		// in rdpspn16.c can inline them, they run four times per pixel per cycle
+		INT32       ColorCombinerEquation(INT32 a, INT32 b, INT32 c, INT32 d)
+		{
+			a = KURT_AKELEY_SIGN9(a);
+			b = KURT_AKELEY_SIGN9(b);
+			c = SIGN9(c);
+			d = KURT_AKELEY_SIGN9(d);
+			a = (((a - b) * c) + (d << 8) + 0x80);
+			a = SIGN17(a) >> 8;
+			a = s_special_9bit_clamptable[a & 0x1ff];
+			return a;
+		}
+		INT32       AlphaCombinerEquation(INT32 a, INT32 b, INT32 c, INT32 d)
+		{
+			a = KURT_AKELEY_SIGN9(a);
+			b = KURT_AKELEY_SIGN9(b);
+			c = SIGN9(c);
+			d = KURT_AKELEY_SIGN9(d);
+			a = (((a - b) * c) + (d << 8) + 0x80) >> 8;
+			a = SIGN9(a);
+			a = s_special_9bit_clamptable[a & 0x1ff];
+			return a;
+		}
 		void        SetSubAInputRGB(UINT8 **input_r, UINT8 **input_g, UINT8 **input_b, int code, rdp_span_aux *userdata);
 		void        SetSubBInputRGB(UINT8 **input_r, UINT8 **input_g, UINT8 **input_b, int code, rdp_span_aux *userdata);
 		void        SetMulInputRGB(UINT8 **input_r, UINT8 **input_g, UINT8 **input_b, int code, rdp_span_aux *userdata);
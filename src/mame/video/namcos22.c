@@ -43,7 +43,7 @@
 
 // polynew constructor
 namcos22_renderer::namcos22_renderer(namcos22_state &state)
-	: poly_manager<float, namcos22_object_data, 4, 8000>(state.machine()),
+	: poly_manager<float, namcos22_object_data, 4, 8000>(state.machine(), POLYFLAG_BIN_BY_BUCKET),
 		m_state(state)
 	{ }
 
@@ -290,7 +290,6 @@ VIDEOS += MC6847
 VIDEOS += MSM6255
 VIDEOS += PC_CGA
 VIDEOS += PC_VGA
-#VIDEOS += POLY
 VIDEOS += PSX
 VIDEOS += RAMDAC
 VIDEOS += S2636
@@ -0,0 +1,64 @@
+import os
+import re
+import subprocess
+import sys
+import shutil
+
+def runProcess(cmd):
+	process = subprocess.Popen(cmd, stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+	(stdout, stderr) = process.communicate()
+	return process.returncode, stdout, stderr
+
+currentDirectory = os.path.dirname(os.path.realpath(__file__))
+tempPath = os.path.join(currentDirectory, "temp")
+if len(sys.argv) > 1:
+	mameBin = os.path.normpath(os.path.join(currentDirectory, "..", "..", "..", sys.argv[1]))
+elif os.name == 'nt':
+	mameBin = os.path.normpath(os.path.join(currentDirectory, "..", "..", "..", "mame.exe"))
+else:
+	mameBin = os.path.normpath(os.path.join(currentDirectory, "..", "..", "..", "mame"))
+
+if not os.path.exists(mameBin):
+	print mameBin + " does not exist"
+	sys.exit(1)
+
+if os.path.exists(tempPath):
+	shutil.rmtree(tempPath)
+os.makedirs(tempPath)
+
+# pongf is fully discrete, so it runs without any ROMs
+commonArgs = [mameBin, "pongf", "-noreadconfig", "-skip_gameinfo", "-video", "none", "-sound", "none", "-nothrottle",
+	"-input_directory", tempPath, "-cfg_directory", tempPath, "-nvram_directory", tempPath]
+
+failure = False
+
+# record a short session to play back
+exitcode, stdout, stderr = runProcess(commonArgs + ["-record", "regtest.inp", "-seconds_to_run", "2"])
+if not exitcode == 0:
+	print "record failed with " + str(exitcode) + " (" + stderr + ")"
+	sys.exit(1)
+
+# play the same recording back twice in one batch
+f = open(os.path.join(tempPath, "regtest.lst"), 'w')
+f.write("# batch playback regression test\nregtest.inp\nregtest.inp\n")
+f.close()
+
+exitcode, stdout, stderr = runProcess(commonArgs + ["-playback_list", "regtest.lst"])
+if not exitcode == 0:
+	print "playback_list failed with " + str(exitcode) + " (" + stderr + ")"
+	failure = True
+
+results = re.findall(r"Playback result: (\S+) frames=(\d+) state_crc=([0-9a-f]{8})", stdout + stderr)
+if not len(results) == 2:
+	print "expected 2 completed playbacks, found " + str(len(results))
+	print stdout + stderr
+	failure = True
+elif not results[0] == results[1]:
+	print "playback mismatch: " + " ".join(results[0]) + " - " + " ".join(results[1])
+	failure = True
+
+if failure:
+	sys.exit(1)
+
+shutil.rmtree(tempPath)
+print "All tests finished successfully"
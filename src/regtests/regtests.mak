@@ -45,6 +45,8 @@
 REGTESTS += \
 	jedutiltest \
 	chdmantest \
+	playbacktest \
+	unidasmtest \
 
 
 
@@ -65,3 +67,23 @@ jedutiltest:
 chdmantest:
 	@echo Running chdman unittest
 	$(PYTHON) $(SRC)/regtests/chdman/chdtest.py
+
+
+
+#-------------------------------------------------
+# batch input playback
+#-------------------------------------------------
+
+playbacktest:
+	@echo Running playback unittest
+	$(PYTHON) $(SRC)/regtests/playback/playbacktest.py $(EMULATOR)
+
+
+
+#-------------------------------------------------
+# unidasm
+#-------------------------------------------------
+
+unidasmtest:
+	@echo Running unidasm unittest
+	$(PYTHON) $(SRC)/regtests/unidasm/tracetest.py
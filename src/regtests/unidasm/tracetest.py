@@ -0,0 +1,89 @@
+import os
+import subprocess
+import sys
+import shutil
+import struct
+import zlib
+
+def runProcess(cmd):
+	process = subprocess.Popen(cmd, stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+	(stdout, stderr) = process.communicate()
+	return process.returncode, stdout, stderr
+
+def varint(value):
+	result = ""
+	while True:
+		data = value & 0x7f
+		value >>= 7
+		if value == 0:
+			return result + chr(data)
+		result += chr(data | 0x80)
+
+def zigzag(delta):
+	if delta < 0:
+		return ((-delta - 1) << 1) | 1
+	return delta << 1
+
+currentDirectory = os.path.dirname(os.path.realpath(__file__))
+tempPath = os.path.join(currentDirectory, "temp")
+if os.name == 'nt':
+	unidasmBin = os.path.normpath(os.path.join(currentDirectory, "..", "..", "..", "unidasm.exe"))
+else:
+	unidasmBin = os.path.normpath(os.path.join(currentDirectory, "..", "..", "..", "unidasm"))
+
+if not os.path.exists(unidasmBin):
+	print unidasmBin + " does not exist"
+	sys.exit(1)
+
+if os.path.exists(tempPath):
+	shutil.rmtree(tempPath)
+os.makedirs(tempPath)
+
+# header: magic, version, opcode bytes, address digits, tag and short name
+tag = ":maincpu"
+trace = "MAMETRC\0" + struct.pack("BBBB", 1, 4, 4, len(tag)) + tag + chr(3) + "z80"
+
+# the varints below are deliberately multi-byte and include bytes that
+# are not valid UTF-8 on their own (0x90, 0x8f, 0xa9, 0xac)
+trace += chr(0) + varint(zigzag(0x8088)) + "\x3e\xa9\x00\x00"
+trace += chr(2) + varint(300)
+trace += chr(3) + varint(6) + "hello\n"
+trace += chr(1) + varint(zigzag(0))
+trace += chr(0) + varint(zigzag(-0x8088)) + "\x00\x00\x00\x00"
+
+traceFile = os.path.join(tempPath, "trace.bin")
+f = open(traceFile, 'wb')
+f.write(zlib.compress(trace))
+f.close()
+
+expected = [
+	"; trace of ':maincpu' (z80)",
+	"8088: ld a,$A9",
+	"",
+	"(loops for 300 instructions)",
+	"",
+	"hello",
+	"8088: ld a,$A9",
+	"0000: nop",
+]
+
+failure = False
+
+exitcode, stdout, stderr = runProcess([unidasmBin, traceFile, "-arch", "z80", "-trace"])
+if not exitcode == 0:
+	print "unidasm failed with " + str(exitcode) + " (" + stderr + ")"
+	failure = True
+
+found = [" ".join(line.split()) for line in stdout.splitlines()]
+if not found == expected:
+	print "expected:"
+	print "\n".join(expected)
+	print "found:"
+	print "\n".join(found)
+	failure = True
+
+if failure:
+	sys.exit(1)
+
+shutil.rmtree(tempPath)
+print "All tests finished successfully"
@@ -0,0 +1,183 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    framecmp.c
+
+    Compare two -framehash logs and report the first frame where they
+    diverge.
+
+****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "astring.h"
+#include "corefile.h"
+
+
+
+/***************************************************************************
+    CONSTANTS & DEFINES
+***************************************************************************/
+
+#define FRAMEHASH_MAGIC         "MAMEFHSH"
+#define FRAMEHASH_VERSION       1
+#define MAX_COMPONENTS          256
+
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+struct hash_log
+{
+	core_file *     file;                       /* open log file */
+	int             count;                      /* number of CRCs per frame */
+	astring         name[MAX_COMPONENTS];       /* name of each CRC */
+};
+
+
+
+/***************************************************************************
+    CORE IMPLEMENTATION
+***************************************************************************/
+
+/*-------------------------------------------------
+    open_log - open a log and parse its header
+-------------------------------------------------*/
+
+static bool open_log(const char *filename, hash_log &log)
+{
+	if (core_fopen(filename, OPEN_FLAG_READ, &log.file) != FILERR_NONE)
+	{
+		fprintf(stderr, "Unable to open %s\n", filename);
+		return false;
+	}
+
+	UINT8 header[10];
+	if (core_fread(log.file, header, sizeof(header)) != sizeof(header) || memcmp(header, FRAMEHASH_MAGIC, 8) != 0)
+	{
+		fprintf(stderr, "%s is not a frame hash log\n", filename);
+		return false;
+	}
+	if (header[8] != FRAMEHASH_VERSION)
+	{
+		fprintf(stderr, "%s has unsupported version %d\n", filename, header[8]);
+		return false;
+	}
+
+	log.count = header[9];
+	for (int index = 0; index < log.count; index++)
+	{
+		char name[256];
+		UINT8 length;
+		if (core_fread(log.file, &length, 1) != 1 || core_fread(log.file, name, length) != length)
+		{
+			fprintf(stderr, "%s has a truncated header\n", filename);
+			return false;
+		}
+		log.name[index].cpy(name, length);
+	}
+	return true;
+}
+
+
+/*-------------------------------------------------
+    read_frame - read one frame's worth of CRCs;
+    returns false at the end of the log
+-------------------------------------------------*/
+
+static bool read_frame(hash_log &log, UINT32 *crc)
+{
+	UINT8 buffer[MAX_COMPONENTS * 4];
+	if (core_fread(log.file, buffer, log.count * 4) != log.count * 4)
+		return false;
+	for (int index = 0; index < log.count; index++)
+		crc[index] = buffer[index * 4 + 0] | (buffer[index * 4 + 1] << 8) | (buffer[index * 4 + 2] << 16) | (buffer[index * 4 + 3] << 24);
+	return true;
+}
+
+
+/*-------------------------------------------------
+    compare_logs - walk both logs in step and
+    report the first difference
+-------------------------------------------------*/
+
+static int compare_logs(hash_log &log1, hash_log &log2)
+{
+	// the components must line up for a frame-by-frame comparison to mean anything
+	if (log1.count != log2.count)
+	{
+		printf("Logs record different components (%d vs %d)\n", log1.count, log2.count);
+		return 1;
+	}
+	for (int index = 0; index < log1.count; index++)
+		if (log1.name[index] != log2.name[index])
+		{
+			printf("Component %d differs: %s vs %s\n", index, log1.name[index].cstr(), log2.name[index].cstr());
+			return 1;
+		}
+
+	UINT32 crc1[MAX_COMPONENTS], crc2[MAX_COMPONENTS];
+	for (UINT32 frame = 0; ; frame++)
+	{
+		bool more1 = read_frame(log1, crc1);
+		bool more2 = read_frame(log2, crc2);
+
+		// both logs ended together: they match
+		if (!more1 && !more2)
+		{
+			printf("Logs match (%d frames)\n", frame);
+			return 0;
+		}
+		if (!more1 || !more2)
+		{
+			printf("Logs match for %d frames, then the %s log ends\n", frame, more1 ? "second" : "first");
+			return 1;
+		}
+
+		// report every component that differs in the first divergent frame
+		bool differs = false;
+		for (int index = 0; index < log1.count; index++)
+			if (crc1[index] != crc2[index])
+			{
+				printf("Frame %d: %s differs (%08X vs %08X)\n", frame, log1.name[index].cstr(), crc1[index], crc2[index]);
+				differs = true;
+			}
+		if (differs)
+			return 1;
+	}
+}
+
+
+
+/***************************************************************************
+    MAIN
+***************************************************************************/
+
+/*-------------------------------------------------
+    main - main entry point
+-------------------------------------------------*/
+
+int main(int argc, char *argv[])
+{
+	if (argc != 3)
+	{
+		fprintf(stderr, "Usage:\nframecmp <log1> <log2>\n");
+		return 10;
+	}
+
+	hash_log log1, log2;
+	log1.file = log2.file = NULL;
+	int result = 10;
+	if (open_log(argv[1], log1) && open_log(argv[2], log2))
+		result = compare_logs(log1, log2);
+
+	if (log1.file != NULL)
+		core_fclose(log1.file);
+	if (log2.file != NULL)
+		core_fclose(log2.file);
+	return result;
+}
@@ -62,6 +62,7 @@ TOOLS += \
 	src2html$(EXE) \
 	split$(EXE) \
 	pngcmp$(EXE) \
+	framecmp$(EXE) \
 	nltool$(EXE) \
 
 
@@ -208,6 +209,19 @@ pngcmp$(EXE): $(PNGCMPOBJS) $(LIBUTIL) $(LIBOCORE) $(ZLIB)
 	@echo Linking $@...
 	$(LD) $(LDFLAGS) $^ $(LIBS) -o $@
 
+
+
+#-------------------------------------------------
+# framecmp
+#-------------------------------------------------
+
+FRAMECMPOBJS = \
+	$(TOOLSOBJ)/framecmp.o \
+
+framecmp$(EXE): $(FRAMECMPOBJS) $(LIBUTIL) $(LIBOCORE) $(ZLIB)
+	@echo Linking $@...
+	$(LD) $(LDFLAGS) $^ $(LIBS) -o $@
+
 #-------------------------------------------------
 # nltool
 #-------------------------------------------------
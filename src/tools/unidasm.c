@@ -9,6 +9,7 @@
 ****************************************************************************/
 
 #include "emu.h"
+#include "debug/debugcpu.h"
 #include <ctype.h>
 
 enum display_type
@@ -49,6 +50,7 @@ struct options
 	UINT8                   lower;
 	UINT8                   upper;
 	UINT8                   flipped;
+	UINT8                   trace;
 	int                     mode;
 	const dasm_table_entry *dasm;
 	UINT32                  skip;
@@ -400,6 +402,8 @@ static int parse_options(int argc, char *argv[], options *opts)
 				opts->norawbytes = TRUE;
 			else if (tolower((UINT8)curarg[1]) == 'u')
 				opts->upper = TRUE;
+			else if (tolower((UINT8)curarg[1]) == 't')
+				opts->trace = TRUE;
 			else
 				goto usage;
 		}
@@ -476,7 +480,7 @@ static int parse_options(int argc, char *argv[], options *opts)
 usage:
 	printf("Usage: %s <filename> -arch <architecture> [-basepc <pc>] \n", argv[0]);
 	printf("   [-mode <n>] [-norawbytes] [-flipped] [-upper] [-lower]\n");
-	printf("   [-skip <n>] [-count <n>]\n");
+	printf("   [-skip <n>] [-count <n>] [-trace]\n");
 	printf("\n");
 	printf("Supported architectures:");
 	numrows = (ARRAY_LENGTH(dasm_table) + 6) / 7;
@@ -494,6 +498,130 @@ usage:
 };
 
 
+// core_fgetc decodes text, so trace records are read a raw byte at a time
+static int read_byte(core_file *file)
+{
+	UINT8 data;
+	if (core_fread(file, &data, 1) != 1)
+		return EOF;
+	return data;
+}
+
+
+static UINT32 read_varint(core_file *file)
+{
+	UINT32 value = 0;
+	for (int shift = 0; shift < 32; shift += 7)
+	{
+		int data = read_byte(file);
+		if (data == EOF)
+			break;
+		value |= (UINT32)(data & 0x7f) << shift;
+		if ((data & 0x80) == 0)
+			break;
+	}
+	return value;
+}
+
+
+static int disassemble_trace(const options &opts)
+{
+	core_file *file;
+	char magic[sizeof(TRACEBIN_MAGIC)];
+	UINT8 header[4];
+	char tag[256], shortname[256];
+	UINT8 taglen, shortlen;
+
+	// open the file and start decompressing
+	if (core_fopen(opts.filename, OPEN_FLAG_READ, &file) != FILERR_NONE)
+	{
+		fprintf(stderr, "Error opening file '%s'\n", opts.filename);
+		return 1;
+	}
+	core_fcompress(file, FCOMPRESS_MEDIUM);
+
+	// validate the header
+	if (core_fread(file, magic, sizeof(magic)) != sizeof(magic) || memcmp(magic, TRACEBIN_MAGIC, sizeof(magic)) != 0 ||
+		core_fread(file, header, sizeof(header)) != sizeof(header) || header[0] != TRACEBIN_VERSION || header[1] == 0 || header[1] > 64 ||
+		core_fread(file, tag, header[3]) != header[3] || core_fread(file, &shortlen, 1) != 1 ||
+		core_fread(file, shortname, shortlen) != shortlen)
+	{
+		fprintf(stderr, "'%s' is not a binary trace file\n", opts.filename);
+		core_fclose(file);
+		return 1;
+	}
+	taglen = header[3];
+	tag[taglen] = 0;
+	shortname[shortlen] = 0;
+	printf("; trace of '%s' (%s)\n", tag, shortname);
+
+	// mirror the writer's opcode cache
+	int opbytes = header[1];
+	int logaddrchars = header[2];
+	dynamic_array<offs_t> cache_pc;
+	dynamic_array<UINT8> cache_bytes;
+	cache_pc.resize_and_clear(TRACEBIN_CACHE_SIZE, 0xff);
+	cache_bytes.resize_and_clear(TRACEBIN_CACHE_SIZE * opbytes);
+
+	offs_t pc = 0;
+	int type;
+	while ((type = read_byte(file)) != EOF)
+	{
+		// loops and tracelog output are passed through
+		if (type == TRACEBIN_LOOPS)
+		{
+			printf("\n   (loops for %d instructions)\n\n", read_varint(file));
+			continue;
+		}
+		if (type == TRACEBIN_TEXT)
+		{
+			UINT32 length = read_varint(file);
+			int data;
+			while (length-- > 0 && (data = read_byte(file)) != EOF)
+				putchar(data);
+			continue;
+		}
+		if (type != TRACEBIN_INSN && type != TRACEBIN_INSN_CACHED)
+		{
+			fprintf(stderr, "Invalid record type %02X in trace\n", type);
+			break;
+		}
+
+		// undo the zigzag PC delta
+		UINT32 delta = read_varint(file);
+		pc += (delta >> 1) ^ -(INT32)(delta & 1);
+
+		// fetch new opcode bytes, or reuse the cached ones
+		int slot = tracebin_cache_index(pc);
+		UINT8 *oprom = &cache_bytes[slot * opbytes];
+		if (type == TRACEBIN_INSN)
+		{
+			if (core_fread(file, oprom, opbytes) != opbytes)
+				break;
+			cache_pc[slot] = pc;
+		}
+
+		// disassemble; only the opcode bytes are logged, so pass them as arguments too
+		char buffer[1024];
+		(*opts.dasm->func)(NULL, buffer, pc, oprom, oprom, opts.mode);
+		if (opts.lower)
+		{
+			for (char *p = buffer; *p != 0; p++)
+				*p = tolower((UINT8)*p);
+		}
+		else if (opts.upper)
+		{
+			for (char *p = buffer; *p != 0; p++)
+				*p = toupper((UINT8)*p);
+		}
+		printf("%0*X: %s\n", logaddrchars, pc, buffer);
+	}
+
+	core_fclose(file);
+	return 0;
+}
+
+
 int main(int argc, char *argv[])
 {
 	file_error filerr;
@@ -513,6 +641,20 @@ int main(int argc, char *argv[])
 	if (parse_options(argc, argv, &opts))
 		return 1;
 
+	// binary traces are handled separately
+	if (opts.trace)
+	{
+		try
+		{
+			return disassemble_trace(opts);
+		}
+		catch (emu_fatalerror &fatal)
+		{
+			fprintf(stderr, "%s\n", fatal.string());
+			return 1;
+		}
+	}
+
 	// load the file
 	filerr = core_fload(opts.filename, &data, &length);
 	if (filerr != FILERR_NONE)